@@ -0,0 +1,417 @@
+"""
+Generate countries_data.hpp: the ISO 3166-1 country table with compile-time perfect hash tables.
+
+Every country has its ISO alpha-2/alpha-3 codes, the UN M49 numeric code, the FAOSTAT area code
+(0 when FAOSTAT does not publish the territory), English/Arabic names and a bit set of the country
+groups (`countries := ['@IGAD']`) it belongs to.
+
+Lookups use a two-level "hash and displace" perfect hash: the first FNV-1a hash picks a bucket,
+the bucket's displacement seeds a second FNV-1a hash that picks a unique slot. The displacement
+and slot tables are searched here and emitted as constexpr arrays, so a lookup is two hashes and
+one string compare with no collisions.
+"""
+import os
+
+# (iso2, iso3, m49, fao_area, name, name_ar)
+COUNTRIES = [
+    ("AF", "AFG", 4, 2, "Afghanistan", "أفغانستان"),
+    ("AX", "ALA", 248, 0, "Åland Islands", "جزر أولاند"),
+    ("AL", "ALB", 8, 3, "Albania", "ألبانيا"),
+    ("DZ", "DZA", 12, 4, "Algeria", "الجزائر"),
+    ("AS", "ASM", 16, 5, "American Samoa", "ساموا الأمريكية"),
+    ("AD", "AND", 20, 6, "Andorra", "أندورا"),
+    ("AO", "AGO", 24, 7, "Angola", "أنغولا"),
+    ("AI", "AIA", 660, 258, "Anguilla", "أنغويلا"),
+    ("AQ", "ATA", 10, 30, "Antarctica", "أنتاركتيكا"),
+    ("AG", "ATG", 28, 8, "Antigua and Barbuda", "أنتيغوا وبربودا"),
+    ("AR", "ARG", 32, 9, "Argentina", "الأرجنتين"),
+    ("AM", "ARM", 51, 1, "Armenia", "أرمينيا"),
+    ("AW", "ABW", 533, 22, "Aruba", "أروبا"),
+    ("AU", "AUS", 36, 10, "Australia", "أستراليا"),
+    ("AT", "AUT", 40, 11, "Austria", "النمسا"),
+    ("AZ", "AZE", 31, 52, "Azerbaijan", "أذربيجان"),
+    ("BS", "BHS", 44, 12, "Bahamas", "جزر البهاما"),
+    ("BH", "BHR", 48, 13, "Bahrain", "البحرين"),
+    ("BD", "BGD", 50, 16, "Bangladesh", "بنغلاديش"),
+    ("BB", "BRB", 52, 14, "Barbados", "باربادوس"),
+    ("BY", "BLR", 112, 57, "Belarus", "بيلاروس"),
+    ("BE", "BEL", 56, 255, "Belgium", "بلجيكا"),
+    ("BZ", "BLZ", 84, 23, "Belize", "بليز"),
+    ("BJ", "BEN", 204, 53, "Benin", "بنين"),
+    ("BM", "BMU", 60, 17, "Bermuda", "برمودا"),
+    ("BT", "BTN", 64, 18, "Bhutan", "بوتان"),
+    ("BO", "BOL", 68, 19, "Bolivia", "بوليفيا"),
+    ("BQ", "BES", 535, 278, "Bonaire, Sint Eustatius and Saba", "بونير وسينت أوستاتيوس وسابا"),
+    ("BA", "BIH", 70, 80, "Bosnia and Herzegovina", "البوسنة والهرسك"),
+    ("BW", "BWA", 72, 20, "Botswana", "بوتسوانا"),
+    ("BV", "BVT", 74, 0, "Bouvet Island", "جزيرة بوفيه"),
+    ("BR", "BRA", 76, 21, "Brazil", "البرازيل"),
+    ("IO", "IOT", 86, 24, "British Indian Ocean Territory", "إقليم المحيط الهندي البريطاني"),
+    ("BN", "BRN", 96, 26, "Brunei Darussalam", "بروناي"),
+    ("BG", "BGR", 100, 27, "Bulgaria", "بلغاريا"),
+    ("BF", "BFA", 854, 233, "Burkina Faso", "بوركينا فاسو"),
+    ("BI", "BDI", 108, 29, "Burundi", "بوروندي"),
+    ("CV", "CPV", 132, 35, "Cabo Verde", "الرأس الأخضر"),
+    ("KH", "KHM", 116, 115, "Cambodia", "كمبوديا"),
+    ("CM", "CMR", 120, 32, "Cameroon", "الكاميرون"),
+    ("CA", "CAN", 124, 33, "Canada", "كندا"),
+    ("KY", "CYM", 136, 36, "Cayman Islands", "جزر كايمان"),
+    ("CF", "CAF", 140, 37, "Central African Republic", "جمهورية أفريقيا الوسطى"),
+    ("TD", "TCD", 148, 39, "Chad", "تشاد"),
+    ("CL", "CHL", 152, 40, "Chile", "تشيلي"),
+    ("CN", "CHN", 156, 41, "China", "الصين"),
+    ("CX", "CXR", 162, 42, "Christmas Island", "جزيرة كريسماس"),
+    ("CC", "CCK", 166, 43, "Cocos (Keeling) Islands", "جزر كوكوس"),
+    ("CO", "COL", 170, 44, "Colombia", "كولومبيا"),
+    ("KM", "COM", 174, 45, "Comoros", "جزر القمر"),
+    ("CG", "COG", 178, 46, "Congo", "الكونغو"),
+    ("CD", "COD", 180, 250, "Democratic Republic of the Congo", "جمهورية الكونغو الديمقراطية"),
+    ("CK", "COK", 184, 47, "Cook Islands", "جزر كوك"),
+    ("CR", "CRI", 188, 48, "Costa Rica", "كوستاريكا"),
+    ("CI", "CIV", 384, 107, "Côte d'Ivoire", "ساحل العاج"),
+    ("HR", "HRV", 191, 98, "Croatia", "كرواتيا"),
+    ("CU", "CUB", 192, 49, "Cuba", "كوبا"),
+    ("CW", "CUW", 531, 279, "Curaçao", "كوراساو"),
+    ("CY", "CYP", 196, 50, "Cyprus", "قبرص"),
+    ("CZ", "CZE", 203, 167, "Czechia", "التشيك"),
+    ("DK", "DNK", 208, 54, "Denmark", "الدنمارك"),
+    ("DJ", "DJI", 262, 72, "Djibouti", "جيبوتي"),
+    ("DM", "DMA", 212, 55, "Dominica", "دومينيكا"),
+    ("DO", "DOM", 214, 56, "Dominican Republic", "جمهورية الدومينيكان"),
+    ("EC", "ECU", 218, 58, "Ecuador", "الإكوادور"),
+    ("EG", "EGY", 818, 59, "Egypt", "مصر"),
+    ("SV", "SLV", 222, 60, "El Salvador", "السلفادور"),
+    ("GQ", "GNQ", 226, 61, "Equatorial Guinea", "غينيا الاستوائية"),
+    ("ER", "ERI", 232, 178, "Eritrea", "إريتريا"),
+    ("EE", "EST", 233, 63, "Estonia", "إستونيا"),
+    ("SZ", "SWZ", 748, 209, "Eswatini", "إسواتيني"),
+    ("ET", "ETH", 231, 238, "Ethiopia", "إثيوبيا"),
+    ("FK", "FLK", 238, 65, "Falkland Islands", "جزر فوكلاند"),
+    ("FO", "FRO", 234, 64, "Faroe Islands", "جزر فارو"),
+    ("FJ", "FJI", 242, 66, "Fiji", "فيجي"),
+    ("FI", "FIN", 246, 67, "Finland", "فنلندا"),
+    ("FR", "FRA", 250, 68, "France", "فرنسا"),
+    ("GF", "GUF", 254, 69, "French Guiana", "غويانا الفرنسية"),
+    ("PF", "PYF", 258, 70, "French Polynesia", "بولينيزيا الفرنسية"),
+    ("TF", "ATF", 260, 0, "French Southern Territories", "الأقاليم الجنوبية الفرنسية"),
+    ("GA", "GAB", 266, 74, "Gabon", "الغابون"),
+    ("GM", "GMB", 270, 75, "Gambia", "غامبيا"),
+    ("GE", "GEO", 268, 73, "Georgia", "جورجيا"),
+    ("DE", "DEU", 276, 79, "Germany", "ألمانيا"),
+    ("GH", "GHA", 288, 81, "Ghana", "غانا"),
+    ("GI", "GIB", 292, 82, "Gibraltar", "جبل طارق"),
+    ("GR", "GRC", 300, 84, "Greece", "اليونان"),
+    ("GL", "GRL", 304, 85, "Greenland", "غرينلاند"),
+    ("GD", "GRD", 308, 86, "Grenada", "غرينادا"),
+    ("GP", "GLP", 312, 87, "Guadeloupe", "غوادلوب"),
+    ("GU", "GUM", 316, 88, "Guam", "غوام"),
+    ("GT", "GTM", 320, 89, "Guatemala", "غواتيمالا"),
+    ("GG", "GGY", 831, 0, "Guernsey", "غيرنزي"),
+    ("GN", "GIN", 324, 90, "Guinea", "غينيا"),
+    ("GW", "GNB", 624, 175, "Guinea-Bissau", "غينيا بيساو"),
+    ("GY", "GUY", 328, 91, "Guyana", "غيانا"),
+    ("HT", "HTI", 332, 93, "Haiti", "هايتي"),
+    ("HM", "HMD", 334, 0, "Heard Island and McDonald Islands", "جزيرة هيرد وجزر ماكدونالد"),
+    ("VA", "VAT", 336, 94, "Holy See", "الفاتيكان"),
+    ("HN", "HND", 340, 95, "Honduras", "هندوراس"),
+    ("HK", "HKG", 344, 96, "Hong Kong", "هونغ كونغ"),
+    ("HU", "HUN", 348, 97, "Hungary", "المجر"),
+    ("IS", "ISL", 352, 99, "Iceland", "آيسلندا"),
+    ("IN", "IND", 356, 100, "India", "الهند"),
+    ("ID", "IDN", 360, 101, "Indonesia", "إندونيسيا"),
+    ("IR", "IRN", 364, 102, "Iran", "إيران"),
+    ("IQ", "IRQ", 368, 103, "Iraq", "العراق"),
+    ("IE", "IRL", 372, 104, "Ireland", "أيرلندا"),
+    ("IM", "IMN", 833, 264, "Isle of Man", "جزيرة مان"),
+    ("IL", "ISR", 376, 105, "Israel", "إسرائيل"),
+    ("IT", "ITA", 380, 106, "Italy", "إيطاليا"),
+    ("JM", "JAM", 388, 109, "Jamaica", "جامايكا"),
+    ("JP", "JPN", 392, 110, "Japan", "اليابان"),
+    ("JE", "JEY", 832, 0, "Jersey", "جيرزي"),
+    ("JO", "JOR", 400, 112, "Jordan", "الأردن"),
+    ("KZ", "KAZ", 398, 108, "Kazakhstan", "كازاخستان"),
+    ("KE", "KEN", 404, 114, "Kenya", "كينيا"),
+    ("KI", "KIR", 296, 83, "Kiribati", "كيريباتي"),
+    ("KP", "PRK", 408, 116, "North Korea", "كوريا الشمالية"),
+    ("KR", "KOR", 410, 117, "South Korea", "كوريا الجنوبية"),
+    ("KW", "KWT", 414, 118, "Kuwait", "الكويت"),
+    ("KG", "KGZ", 417, 113, "Kyrgyzstan", "قيرغيزستان"),
+    ("LA", "LAO", 418, 120, "Lao People's Democratic Republic", "لاوس"),
+    ("LV", "LVA", 428, 119, "Latvia", "لاتفيا"),
+    ("LB", "LBN", 422, 121, "Lebanon", "لبنان"),
+    ("LS", "LSO", 426, 122, "Lesotho", "ليسوتو"),
+    ("LR", "LBR", 430, 123, "Liberia", "ليبيريا"),
+    ("LY", "LBY", 434, 124, "Libya", "ليبيا"),
+    ("LI", "LIE", 438, 125, "Liechtenstein", "ليختنشتاين"),
+    ("LT", "LTU", 440, 126, "Lithuania", "ليتوانيا"),
+    ("LU", "LUX", 442, 256, "Luxembourg", "لوكسمبورغ"),
+    ("MO", "MAC", 446, 128, "Macao", "ماكاو"),
+    ("MG", "MDG", 450, 129, "Madagascar", "مدغشقر"),
+    ("MW", "MWI", 454, 130, "Malawi", "مالاوي"),
+    ("MY", "MYS", 458, 131, "Malaysia", "ماليزيا"),
+    ("MV", "MDV", 462, 132, "Maldives", "جزر المالديف"),
+    ("ML", "MLI", 466, 133, "Mali", "مالي"),
+    ("MT", "MLT", 470, 134, "Malta", "مالطا"),
+    ("MH", "MHL", 584, 127, "Marshall Islands", "جزر مارشال"),
+    ("MQ", "MTQ", 474, 135, "Martinique", "مارتينيك"),
+    ("MR", "MRT", 478, 136, "Mauritania", "موريتانيا"),
+    ("MU", "MUS", 480, 137, "Mauritius", "موريشيوس"),
+    ("YT", "MYT", 175, 270, "Mayotte", "مايوت"),
+    ("MX", "MEX", 484, 138, "Mexico", "المكسيك"),
+    ("FM", "FSM", 583, 145, "Micronesia", "ميكرونيزيا"),
+    ("MD", "MDA", 498, 146, "Moldova", "مولدوفا"),
+    ("MC", "MCO", 492, 140, "Monaco", "موناكو"),
+    ("MN", "MNG", 496, 141, "Mongolia", "منغوليا"),
+    ("ME", "MNE", 499, 273, "Montenegro", "الجبل الأسود"),
+    ("MS", "MSR", 500, 142, "Montserrat", "مونتسرات"),
+    ("MA", "MAR", 504, 143, "Morocco", "المغرب"),
+    ("MZ", "MOZ", 508, 144, "Mozambique", "موزمبيق"),
+    ("MM", "MMR", 104, 28, "Myanmar", "ميانمار"),
+    ("NA", "NAM", 516, 147, "Namibia", "ناميبيا"),
+    ("NR", "NRU", 520, 148, "Nauru", "ناورو"),
+    ("NP", "NPL", 524, 149, "Nepal", "نيبال"),
+    ("NL", "NLD", 528, 150, "Netherlands", "هولندا"),
+    ("NC", "NCL", 540, 153, "New Caledonia", "كاليدونيا الجديدة"),
+    ("NZ", "NZL", 554, 156, "New Zealand", "نيوزيلندا"),
+    ("NI", "NIC", 558, 157, "Nicaragua", "نيكاراغوا"),
+    ("NE", "NER", 562, 158, "Niger", "النيجر"),
+    ("NG", "NGA", 566, 159, "Nigeria", "نيجيريا"),
+    ("NU", "NIU", 570, 160, "Niue", "نيوي"),
+    ("NF", "NFK", 574, 161, "Norfolk Island", "جزيرة نورفولك"),
+    ("MK", "MKD", 807, 154, "North Macedonia", "مقدونيا الشمالية"),
+    ("MP", "MNP", 580, 163, "Northern Mariana Islands", "جزر ماريانا الشمالية"),
+    ("NO", "NOR", 578, 162, "Norway", "النرويج"),
+    ("OM", "OMN", 512, 221, "Oman", "عمان"),
+    ("PK", "PAK", 586, 165, "Pakistan", "باكستان"),
+    ("PW", "PLW", 585, 180, "Palau", "بالاو"),
+    ("PS", "PSE", 275, 299, "Palestine", "فلسطين"),
+    ("PA", "PAN", 591, 166, "Panama", "بنما"),
+    ("PG", "PNG", 598, 168, "Papua New Guinea", "بابوا غينيا الجديدة"),
+    ("PY", "PRY", 600, 169, "Paraguay", "باراغواي"),
+    ("PE", "PER", 604, 170, "Peru", "بيرو"),
+    ("PH", "PHL", 608, 171, "Philippines", "الفلبين"),
+    ("PN", "PCN", 612, 172, "Pitcairn", "جزر بيتكيرن"),
+    ("PL", "POL", 616, 173, "Poland", "بولندا"),
+    ("PT", "PRT", 620, 174, "Portugal", "البرتغال"),
+    ("PR", "PRI", 630, 177, "Puerto Rico", "بورتوريكو"),
+    ("QA", "QAT", 634, 179, "Qatar", "قطر"),
+    ("RE", "REU", 638, 182, "Réunion", "ريونيون"),
+    ("RO", "ROU", 642, 183, "Romania", "رومانيا"),
+    ("RU", "RUS", 643, 185, "Russian Federation", "روسيا"),
+    ("RW", "RWA", 646, 184, "Rwanda", "رواندا"),
+    ("BL", "BLM", 652, 282, "Saint Barthélemy", "سان بارتيلمي"),
+    ("SH", "SHN", 654, 187, "Saint Helena, Ascension and Tristan da Cunha", "سانت هيلينا"),
+    ("KN", "KNA", 659, 188, "Saint Kitts and Nevis", "سانت كيتس ونيفيس"),
+    ("LC", "LCA", 662, 189, "Saint Lucia", "سانت لوسيا"),
+    ("MF", "MAF", 663, 283, "Saint Martin (French part)", "سان مارتن"),
+    ("PM", "SPM", 666, 190, "Saint Pierre and Miquelon", "سان بيير وميكلون"),
+    ("VC", "VCT", 670, 191, "Saint Vincent and the Grenadines", "سانت فنسنت والغرينادين"),
+    ("WS", "WSM", 882, 244, "Samoa", "ساموا"),
+    ("SM", "SMR", 674, 192, "San Marino", "سان مارينو"),
+    ("ST", "STP", 678, 193, "Sao Tome and Principe", "ساو تومي وبرينسيب"),
+    ("SA", "SAU", 682, 194, "Saudi Arabia", "السعودية"),
+    ("SN", "SEN", 686, 195, "Senegal", "السنغال"),
+    ("RS", "SRB", 688, 272, "Serbia", "صربيا"),
+    ("SC", "SYC", 690, 196, "Seychelles", "سيشل"),
+    ("SL", "SLE", 694, 197, "Sierra Leone", "سيراليون"),
+    ("SG", "SGP", 702, 200, "Singapore", "سنغافورة"),
+    ("SX", "SXM", 534, 281, "Sint Maarten (Dutch part)", "سينت مارتن"),
+    ("SK", "SVK", 703, 199, "Slovakia", "سلوفاكيا"),
+    ("SI", "SVN", 705, 198, "Slovenia", "سلوفينيا"),
+    ("SB", "SLB", 90, 25, "Solomon Islands", "جزر سليمان"),
+    ("SO", "SOM", 706, 201, "Somalia", "الصومال"),
+    ("ZA", "ZAF", 710, 202, "South Africa", "جنوب أفريقيا"),
+    ("GS", "SGS", 239, 0, "South Georgia and the South Sandwich Islands", "جورجيا الجنوبية وجزر ساندويتش الجنوبية"),
+    ("SS", "SSD", 728, 277, "South Sudan", "جنوب السودان"),
+    ("ES", "ESP", 724, 203, "Spain", "إسبانيا"),
+    ("LK", "LKA", 144, 38, "Sri Lanka", "سريلانكا"),
+    ("SD", "SDN", 729, 276, "Sudan", "السودان"),
+    ("SR", "SUR", 740, 207, "Suriname", "سورينام"),
+    ("SJ", "SJM", 744, 260, "Svalbard and Jan Mayen", "سفالبارد ويان ماين"),
+    ("SE", "SWE", 752, 210, "Sweden", "السويد"),
+    ("CH", "CHE", 756, 211, "Switzerland", "سويسرا"),
+    ("SY", "SYR", 760, 212, "Syrian Arab Republic", "سوريا"),
+    ("TW", "TWN", 158, 214, "Taiwan", "تايوان"),
+    ("TJ", "TJK", 762, 208, "Tajikistan", "طاجيكستان"),
+    ("TZ", "TZA", 834, 215, "Tanzania", "تنزانيا"),
+    ("TH", "THA", 764, 216, "Thailand", "تايلاند"),
+    ("TL", "TLS", 626, 176, "Timor-Leste", "تيمور الشرقية"),
+    ("TG", "TGO", 768, 217, "Togo", "توغو"),
+    ("TK", "TKL", 772, 218, "Tokelau", "توكيلاو"),
+    ("TO", "TON", 776, 219, "Tonga", "تونغا"),
+    ("TT", "TTO", 780, 220, "Trinidad and Tobago", "ترينيداد وتوباغو"),
+    ("TN", "TUN", 788, 222, "Tunisia", "تونس"),
+    ("TR", "TUR", 792, 223, "Türkiye", "تركيا"),
+    ("TM", "TKM", 795, 213, "Turkmenistan", "تركمانستان"),
+    ("TC", "TCA", 796, 224, "Turks and Caicos Islands", "جزر توركس وكايكوس"),
+    ("TV", "TUV", 798, 227, "Tuvalu", "توفالو"),
+    ("UG", "UGA", 800, 226, "Uganda", "أوغندا"),
+    ("UA", "UKR", 804, 230, "Ukraine", "أوكرانيا"),
+    ("AE", "ARE", 784, 225, "United Arab Emirates", "الإمارات العربية المتحدة"),
+    ("GB", "GBR", 826, 229, "United Kingdom", "المملكة المتحدة"),
+    ("US", "USA", 840, 231, "United States", "الولايات المتحدة"),
+    ("UM", "UMI", 581, 0, "United States Minor Outlying Islands", "جزر الولايات المتحدة الصغيرة النائية"),
+    ("UY", "URY", 858, 234, "Uruguay", "الأوروغواي"),
+    ("UZ", "UZB", 860, 235, "Uzbekistan", "أوزبكستان"),
+    ("VU", "VUT", 548, 155, "Vanuatu", "فانواتو"),
+    ("VE", "VEN", 862, 236, "Venezuela", "فنزويلا"),
+    ("VN", "VNM", 704, 237, "Viet Nam", "فيتنام"),
+    ("VG", "VGB", 92, 239, "British Virgin Islands", "جزر العذراء البريطانية"),
+    ("VI", "VIR", 850, 240, "United States Virgin Islands", "جزر العذراء الأمريكية"),
+    ("WF", "WLF", 876, 243, "Wallis and Futuna", "واليس وفوتونا"),
+    ("EH", "ESH", 732, 205, "Western Sahara", "الصحراء الغربية"),
+    ("YE", "YEM", 887, 249, "Yemen", "اليمن"),
+    ("ZM", "ZMB", 894, 251, "Zambia", "زامبيا"),
+    ("ZW", "ZWE", 716, 181, "Zimbabwe", "زيمبابوي"),
+]
+
+# (name, description, members). The bit of a group is its position in this list.
+GROUPS = [
+    ("NEIGHBORS", "Countries bordering Sudan",
+     ["EGY", "LBY", "TCD", "CAF", "SSD", "ETH", "ERI"]),
+    ("IGAD", "Intergovernmental Authority on Development",
+     ["DJI", "ERI", "ETH", "KEN", "SOM", "SSD", "SDN", "UGA"]),
+    ("NILE_BASIN", "Nile Basin countries",
+     ["BDI", "COD", "EGY", "ERI", "ETH", "KEN", "RWA", "SSD", "SDN", "TZA", "UGA"]),
+    ("SAHEL", "Sahel countries of the UN Integrated Strategy for the Sahel",
+     ["BFA", "CMR", "TCD", "GMB", "GIN", "MLI", "MRT", "NER", "NGA", "SEN"]),
+    ("AFRICA", "The 54 African UN member states",
+     ["DZA", "AGO", "BEN", "BWA", "BFA", "BDI", "CPV", "CMR", "CAF", "TCD", "COM", "COG", "COD", "CIV",
+      "DJI", "EGY", "GNQ", "ERI", "SWZ", "ETH", "GAB", "GMB", "GHA", "GIN", "GNB", "KEN", "LSO", "LBR",
+      "LBY", "MDG", "MWI", "MLI", "MRT", "MUS", "MAR", "MOZ", "NAM", "NER", "NGA", "RWA", "STP", "SEN",
+      "SYC", "SLE", "SOM", "ZAF", "SSD", "SDN", "TZA", "TGO", "TUN", "UGA", "ZMB", "ZWE"]),
+]
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+# Hash table shape, must match the constants emitted into the header
+HASH_BUCKETS = 64
+HASH_SLOTS = 512
+EMPTY_SLOT = 0xFFFF
+
+
+def country_code_hash(code, seed):
+    """FNV-1a with a seeded offset basis, identical to CountryCodeHash() in C++."""
+    h = (FNV_OFFSET ^ seed) & 0xFFFFFFFF
+    for c in code.encode("ascii"):
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def build_perfect_hash(keys):
+    """Hash and displace: returns (displacements, slots) with slots[i] = index into COUNTRIES."""
+    buckets = [[] for _ in range(HASH_BUCKETS)]
+    for index, key in enumerate(keys):
+        buckets[country_code_hash(key, 0) % HASH_BUCKETS].append((key, index))
+
+    displacements = [0] * HASH_BUCKETS
+    slots = [EMPTY_SLOT] * HASH_SLOTS
+    # Place the largest buckets first while the table is still sparse
+    for bucket_idx in sorted(range(HASH_BUCKETS), key=lambda b: -len(buckets[b])):
+        bucket = buckets[bucket_idx]
+        if not bucket:
+            continue
+        for displacement in range(1, 1 << 16):
+            candidate = [country_code_hash(key, displacement) % HASH_SLOTS for key, _ in bucket]
+            if len(set(candidate)) == len(candidate) and all(slots[s] == EMPTY_SLOT for s in candidate):
+                break
+        else:
+            raise RuntimeError(f"No displacement found for bucket {bucket_idx}")
+        displacements[bucket_idx] = displacement
+        for (key, index), slot in zip(bucket, candidate):
+            slots[slot] = index
+    return displacements, slots
+
+
+def cpp_string(s):
+    """C++ string literal with non-ASCII bytes escaped (split after escapes so hex digits are not absorbed)."""
+    out = '"'
+    escaped = False
+    for byte in s.encode("utf-8"):
+        ch = chr(byte)
+        if byte >= 0x80:
+            out += f"\\x{byte:02x}"
+            escaped = True
+            continue
+        if escaped and ch in "0123456789abcdefABCDEF":
+            out += '" "'
+        escaped = False
+        if ch in '"\\':
+            out += "\\" + ch
+        else:
+            out += ch
+    return out + '"'
+
+
+def format_table(name, values, per_line=16):
+    lines = [f"static constexpr uint16_t {name}[] = {{"]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return lines
+
+
+def main():
+    output_file = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+                               "src", "sudan", "countries_data.hpp")
+
+    iso3_set = {c[1] for c in COUNTRIES}
+    group_bits = {}
+    for bit, (group_name, _, members) in enumerate(GROUPS):
+        assert len(set(members)) == len(members), f"duplicate member in {group_name}"
+        for iso3 in members:
+            assert iso3 in iso3_set, f"unknown member {iso3} in {group_name}"
+            group_bits[iso3] = group_bits.get(iso3, 0) | (1 << bit)
+    assert len(GROUPS[-1][2]) == 54
+
+    iso2_keys = [c[0] for c in COUNTRIES]
+    iso3_keys = [c[1] for c in COUNTRIES]
+    m49_keys = [f"{c[2]:03d}" for c in COUNTRIES]
+    for keys in (iso2_keys, iso3_keys, m49_keys):
+        assert len(set(keys)) == len(keys), "duplicate country code"
+
+    lines = []
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append("// Auto-generated ISO 3166-1 country table with perfect hash lookup tables")
+    lines.append("// Do not edit manually - regenerate with scripts/generate_countries.py")
+    lines.append("")
+    lines.append('#include "sudan/providers.hpp"')
+    lines.append("")
+    lines.append("namespace sudan {")
+    lines.append("")
+    lines.append(f"static constexpr uint32_t COUNTRY_HASH_BUCKETS = {HASH_BUCKETS};")
+    lines.append(f"static constexpr uint32_t COUNTRY_HASH_SLOTS = {HASH_SLOTS};")
+    lines.append(f"static constexpr uint16_t COUNTRY_HASH_EMPTY = 0x{EMPTY_SLOT:X};")
+    lines.append("")
+    lines.append(f"static constexpr CountryInfo COUNTRIES[] = {{")
+    for iso2, iso3, m49, fao, name, name_ar in COUNTRIES:
+        groups = group_bits.get(iso3, 0)
+        lines.append(f'    {{"{iso3}", "{iso2}", {m49}, {fao}, {groups}, {cpp_string(name)}, {cpp_string(name_ar)}}},')
+    lines.append("};")
+    lines.append("")
+    lines.append("static constexpr CountryGroup COUNTRY_GROUPS[] = {")
+    for bit, (group_name, description, _) in enumerate(GROUPS):
+        lines.append(f'    {{"{group_name}", {1 << bit}, {cpp_string(description)}}},')
+    lines.append("};")
+    lines.append("")
+
+    for label, keys in (("ISO3", iso3_keys), ("ISO2", iso2_keys), ("M49", m49_keys)):
+        displacements, slots = build_perfect_hash(keys)
+        lines.append(f"// {label} perfect hash: bucket displacements and slot -> COUNTRIES index")
+        lines.extend(format_table(f"{label}_DISPLACEMENTS", displacements))
+        lines.extend(format_table(f"{label}_SLOTS", slots))
+        lines.append("")
+        print(f"  {label}: {len(keys)} keys, max displacement {max(displacements)}")
+
+    lines.append("} // namespace sudan")
+    lines.append("")
+
+    with open(output_file, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+    print(f"Wrote {len(COUNTRIES)} countries to {output_file}")
+
+
+if __name__ == "__main__":
+    main()
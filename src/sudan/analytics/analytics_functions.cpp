@@ -0,0 +1,1003 @@
+#include "analytics_functions.hpp"
+#include "function_builder.hpp"
+
+// DuckDB
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "yyjson.hpp"
+using namespace duckdb_yyjson; // NOLINT
+
+// SUDAN
+#include "sudan/conversion_table.hpp"
+#include "sudan/provider_scan.hpp"
+#include "sudan/providers.hpp"
+#include "sudan/series_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+
+namespace duckdb {
+
+namespace {
+
+//======================================================================================================================
+// SUDAN_Fill (Table In-Out Function)
+//======================================================================================================================
+//
+// Rows arrive ordered by series and year, and a series is a run of rows with the same key columns. Runs inside a
+// chunk are complete and filled as soon as the chunk arrives. The first and last run of a chunk may continue in a
+// chunk another thread processes, so their rows are collected by series and filled once all input is consumed.
+
+struct SudanFill {
+
+	struct BindData final : TableFunctionData {
+		sudan::FillMethod method = sudan::FillMethod::LINEAR;
+		idx_t year_index = DConstants::INVALID_INDEX;
+		idx_t value_index = DConstants::INVALID_INDEX;
+		//! Columns that identify a series
+		vector<idx_t> key_indexes;
+		idx_t input_column_count = 0;
+	};
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+		auto bind_data = make_uniq<BindData>();
+		auto &types = input.input_table_types;
+		auto &columns = input.input_table_names;
+		bind_data->input_column_count = columns.size();
+
+		auto find_column = [&](const string &name) {
+			for (idx_t i = 0; i < columns.size(); i++) {
+				if (StringUtil::CIEquals(columns[i], name)) {
+					return i;
+				}
+			}
+			return DConstants::INVALID_INDEX;
+		};
+		bind_data->year_index = find_column("year");
+		bind_data->value_index = find_column("value");
+		if (bind_data->year_index == DConstants::INVALID_INDEX || !types[bind_data->year_index].IsIntegral()) {
+			throw InvalidInputException("SUDAN: SUDAN_Fill requires an integer 'year' column");
+		}
+		if (bind_data->value_index == DConstants::INVALID_INDEX || !types[bind_data->value_index].IsNumeric()) {
+			throw InvalidInputException("SUDAN: SUDAN_Fill requires a numeric 'value' column");
+		}
+
+		bool has_by = false;
+		for (auto &param : input.named_parameters) {
+			if (param.first == "method") {
+				auto method = StringValue::Get(param.second);
+				if (!sudan::ParseFillMethod(method, bind_data->method)) {
+					throw InvalidInputException("SUDAN: SUDAN_Fill method must be 'linear', 'locf' or 'spline', got '%s'",
+					                            method);
+				}
+			} else if (param.first == "by") {
+				has_by = true;
+				for (auto &name : ListValue::GetChildren(param.second)) {
+					auto index = find_column(StringValue::Get(name));
+					if (index == DConstants::INVALID_INDEX) {
+						throw InvalidInputException("SUDAN: SUDAN_Fill 'by' column '%s' not found in the input",
+						                            StringValue::Get(name));
+					}
+					if (index == bind_data->year_index || index == bind_data->value_index) {
+						throw InvalidInputException("SUDAN: SUDAN_Fill 'by' cannot include the year or value column");
+					}
+					bind_data->key_indexes.push_back(index);
+				}
+			}
+		}
+		if (!has_by) {
+			// Every other column: descriptive columns such as country_name repeat within a series anyway
+			for (idx_t i = 0; i < columns.size(); i++) {
+				if (i != bind_data->year_index && i != bind_data->value_index) {
+					bind_data->key_indexes.push_back(i);
+				}
+			}
+		}
+
+		for (idx_t i = 0; i < columns.size(); i++) {
+			names.push_back(columns[i]);
+			return_types.push_back(i == bind_data->value_index ? LogicalType::DOUBLE : types[i]);
+		}
+		names.emplace_back("filled");
+		return_types.push_back(LogicalType::BOOLEAN);
+		return std::move(bind_data);
+	}
+
+	//! A row of a run that may continue in another thread's chunk
+	struct PendingRow {
+		int64_t year;
+		double value;
+		bool valid;
+		vector<Value> row;
+	};
+
+	struct GlobalState final : GlobalTableFunctionState {
+		std::mutex lock;
+		//! Rows of runs at chunk edges by series key, in key order so the output is deterministic
+		std::map<string, vector<PendingRow>> pending;
+		//! Threads that have not finalized yet; the last one emits the pending series
+		idx_t active_threads = 0;
+		bool pending_claimed = false;
+	};
+
+	struct LocalState final : LocalTableFunctionState {
+		//! Filled rows of the current input chunk, and how many of them were emitted
+		sudan::FilledSeries out;
+		idx_t emitted = 0;
+		bool chunk_processed = false;
+		vector<uint8_t> valid;
+
+		//! The pending series, for the thread that emits them
+		bool final_started = false;
+		vector<PendingRow> final_rows;
+	};
+
+	static unique_ptr<GlobalTableFunctionState> InitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+		return make_uniq_base<GlobalTableFunctionState, GlobalState>();
+	}
+
+	static unique_ptr<LocalTableFunctionState> InitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+	                                                     GlobalTableFunctionState *global_state) {
+		auto &global = global_state->Cast<GlobalState>();
+		std::lock_guard<std::mutex> guard(global.lock);
+		global.active_threads++;
+		return make_uniq_base<LocalTableFunctionState, LocalState>();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void CheckYears(const int64_t *years, idx_t count) {
+		for (idx_t i = 1; i < count; i++) {
+			if (years[i] <= years[i - 1]) {
+				throw InvalidInputException("SUDAN: SUDAN_Fill input must be ordered by series and year, with one row "
+				                            "per year (year %lld follows %lld)",
+				                            years[i], years[i - 1]);
+			}
+		}
+	}
+
+	static string SeriesKey(DataChunk &input, const vector<idx_t> &key_indexes, idx_t row) {
+		string key;
+		for (auto index : key_indexes) {
+			auto value = input.GetValue(index, row);
+			if (value.IsNull()) {
+				key += "N;";
+			} else {
+				auto text = value.ToString();
+				key += to_string(text.size()) + ":" + text;
+			}
+		}
+		return key;
+	}
+
+	static void ProcessChunk(ClientContext &context, const BindData &bind_data, GlobalState &global, LocalState &local,
+	                         DataChunk &input) {
+		auto count = input.size();
+		if (count == 0) {
+			return;
+		}
+
+		Vector years(LogicalType::BIGINT, count);
+		VectorOperations::Cast(context, input.data[bind_data.year_index], years, count);
+		years.Flatten(count);
+		if (!FlatVector::Validity(years).AllValid()) {
+			throw InvalidInputException("SUDAN: SUDAN_Fill cannot fill rows with a NULL year");
+		}
+		auto year_data = FlatVector::GetData<int64_t>(years);
+
+		Vector values(LogicalType::DOUBLE, count);
+		VectorOperations::Cast(context, input.data[bind_data.value_index], values, count);
+		values.Flatten(count);
+		auto value_data = FlatVector::GetData<double>(values);
+		auto &value_validity = FlatVector::Validity(values);
+		local.valid.resize(count);
+		for (idx_t i = 0; i < count; i++) {
+			local.valid[i] = value_validity.RowIsValid(i);
+		}
+
+		// Runs start where the key hash changes
+		Vector hashes(LogicalType::HASH, count);
+		hash_t *hash_data = nullptr;
+		if (!bind_data.key_indexes.empty()) {
+			VectorOperations::Hash(input.data[bind_data.key_indexes[0]], hashes, count);
+			for (idx_t k = 1; k < bind_data.key_indexes.size(); k++) {
+				VectorOperations::CombineHash(hashes, input.data[bind_data.key_indexes[k]], count);
+			}
+			hashes.Flatten(count);
+			hash_data = FlatVector::GetData<hash_t>(hashes);
+		}
+
+		vector<pair<idx_t, idx_t>> edge_runs;
+		idx_t run_start = 0;
+		for (idx_t i = 1; i <= count; i++) {
+			if (i < count && (!hash_data || hash_data[i] == hash_data[i - 1])) {
+				continue;
+			}
+			CheckYears(year_data + run_start, i - run_start);
+			if (run_start == 0 || i == count) {
+				edge_runs.emplace_back(run_start, i);
+			} else {
+				sudan::FillSeries(year_data + run_start, value_data + run_start, local.valid.data() + run_start,
+				                  i - run_start, run_start, bind_data.method, local.out);
+			}
+			run_start = i;
+		}
+
+		std::lock_guard<std::mutex> guard(global.lock);
+		for (auto &run : edge_runs) {
+			auto &rows = global.pending[SeriesKey(input, bind_data.key_indexes, run.first)];
+			for (auto i = run.first; i < run.second; i++) {
+				PendingRow row;
+				row.year = year_data[i];
+				row.value = value_data[i];
+				row.valid = local.valid[i];
+				for (idx_t c = 0; c < bind_data.input_column_count; c++) {
+					row.row.push_back(input.GetValue(c, i));
+				}
+				rows.push_back(std::move(row));
+			}
+		}
+	}
+
+	//! Write the filled year, value and flag columns of output rows [offset, offset + count)
+	static void WriteFilledColumns(ClientContext &context, const BindData &bind_data, const sudan::FilledSeries &out,
+	                               idx_t offset, idx_t count, DataChunk &output) {
+		Vector years(LogicalType::BIGINT, count);
+		auto year_data = FlatVector::GetData<int64_t>(years);
+		auto value_data = FlatVector::GetData<double>(output.data[bind_data.value_index]);
+		auto &value_validity = FlatVector::Validity(output.data[bind_data.value_index]);
+		auto filled_data = FlatVector::GetData<bool>(output.data[bind_data.input_column_count]);
+		for (idx_t i = 0; i < count; i++) {
+			year_data[i] = out.years[offset + i];
+			value_data[i] = out.values[offset + i];
+			if (!out.valid[offset + i]) {
+				value_validity.SetInvalid(i);
+			}
+			filled_data[i] = out.filled[offset + i];
+		}
+		VectorOperations::Cast(context, years, output.data[bind_data.year_index], count);
+	}
+
+	static OperatorResultType Execute(ExecutionContext &context, TableFunctionInput &data, DataChunk &input,
+	                                  DataChunk &output) {
+		auto &bind_data = data.bind_data->Cast<BindData>();
+		auto &global = data.global_state->Cast<GlobalState>();
+		auto &local = data.local_state->Cast<LocalState>();
+
+		// Called again with the same input while it has more output
+		if (!local.chunk_processed) {
+			ProcessChunk(context.client, bind_data, global, local, input);
+			local.chunk_processed = true;
+		}
+
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, local.out.Size() - local.emitted);
+		if (count > 0) {
+			// Other columns come straight from the input rows, without copying
+			SelectionVector sel(count);
+			for (idx_t i = 0; i < count; i++) {
+				sel.set_index(i, local.out.source[local.emitted + i]);
+			}
+			for (idx_t c = 0; c < bind_data.input_column_count; c++) {
+				if (c != bind_data.year_index && c != bind_data.value_index) {
+					output.data[c].Slice(input.data[c], sel, count);
+				}
+			}
+			WriteFilledColumns(context.client, bind_data, local.out, local.emitted, count, output);
+			local.emitted += count;
+		}
+		output.SetCardinality(count);
+
+		if (local.emitted < local.out.Size()) {
+			return OperatorResultType::HAVE_MORE_OUTPUT;
+		}
+		local.out.Clear();
+		local.emitted = 0;
+		local.chunk_processed = false;
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Finalize
+	//------------------------------------------------------------------------------------------------------------------
+
+	static OperatorFinalizeResultType Finalize(ExecutionContext &context, TableFunctionInput &data,
+	                                           DataChunk &output) {
+		auto &bind_data = data.bind_data->Cast<BindData>();
+		auto &global = data.global_state->Cast<GlobalState>();
+		auto &local = data.local_state->Cast<LocalState>();
+
+		if (!local.final_started) {
+			local.final_started = true;
+			std::map<string, vector<PendingRow>> pending;
+			{
+				std::lock_guard<std::mutex> guard(global.lock);
+				global.active_threads--;
+				if (global.active_threads > 0 || global.pending_claimed) {
+					return OperatorFinalizeResultType::FINISHED;
+				}
+				global.pending_claimed = true;
+				pending = std::move(global.pending);
+			}
+
+			vector<int64_t> years;
+			vector<double> values;
+			vector<uint8_t> valid;
+			for (auto &series : pending) {
+				auto &rows = series.second;
+				std::stable_sort(rows.begin(), rows.end(),
+				                 [](const PendingRow &a, const PendingRow &b) { return a.year < b.year; });
+				years.clear();
+				values.clear();
+				valid.clear();
+				for (auto &row : rows) {
+					years.push_back(row.year);
+					values.push_back(row.value);
+					valid.push_back(row.valid);
+				}
+				CheckYears(years.data(), years.size());
+				sudan::FillSeries(years.data(), values.data(), valid.data(), rows.size(), local.final_rows.size(),
+				                  bind_data.method, local.out);
+				for (auto &row : rows) {
+					local.final_rows.push_back(std::move(row));
+				}
+			}
+		}
+
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, local.out.Size() - local.emitted);
+		for (idx_t i = 0; i < count; i++) {
+			auto &row = local.final_rows[local.out.source[local.emitted + i]].row;
+			for (idx_t c = 0; c < bind_data.input_column_count; c++) {
+				if (c != bind_data.year_index && c != bind_data.value_index) {
+					output.data[c].SetValue(i, row[c]);
+				}
+			}
+		}
+		WriteFilledColumns(context.client, bind_data, local.out, local.emitted, count, output);
+		local.emitted += count;
+		output.SetCardinality(count);
+		return local.emitted < local.out.Size() ? OperatorFinalizeResultType::HAVE_MORE_OUTPUT
+		                                        : OperatorFinalizeResultType::FINISHED;
+	}
+
+	static constexpr auto DESCRIPTION = R"(
+		Fills the gaps of annual series: NULL values, and years missing between the first and last year of each
+		series. Input rows must be ordered by series and year; a series is a run of rows with the same key columns
+		(by default every column except year and value). Adds a 'filled' column marking estimated values.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT * FROM SUDAN_Fill((
+		    SELECT country, year, value FROM SUDAN_WorldBank('SP.POP.TOTL', sorted := true)
+		), method := 'linear');
+	)";
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		TableFunction func("SUDAN_Fill", {LogicalType::TABLE}, nullptr, Bind, InitGlobal, InitLocal);
+		func.in_out_function = Execute;
+		func.in_out_function_final = Finalize;
+		func.named_parameters["method"] = LogicalType::VARCHAR;
+		func.named_parameters["by"] = LogicalType::LIST(LogicalType::VARCHAR);
+
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+	}
+};
+
+//======================================================================================================================
+// SUDAN_CAGR, SUDAN_Growth, SUDAN_Rebase (Aggregate Functions)
+//======================================================================================================================
+//
+// Aggregates over (value, year) whose states are a few scalars from series_kernels.hpp. Combine merges states in any
+// order, so they aggregate in parallel, and over a window DuckDB answers each frame from a segment tree of states
+// instead of rescanning it. With ORDER BY year, the default running frame ends at the current row, so the latest
+// year of the frame is the row itself: SUDAN_Growth and SUDAN_Rebase give each row's value.
+
+//! Shared state handling: the kernels initialize, merge and finalize themselves
+struct SeriesAggregate {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.Initialize();
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
+		target.Merge(source);
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
+struct CAGROperation : SeriesAggregate {
+	template <class A_TYPE, class B_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const A_TYPE &value, const B_TYPE &year, AggregateBinaryInput &input) {
+		state.Add(year, value);
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.CompoundGrowth(target)) {
+			finalize_data.ReturnNull();
+		}
+	}
+};
+
+struct GrowthOperation : SeriesAggregate {
+	template <class A_TYPE, class B_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const A_TYPE &value, const B_TYPE &year, AggregateBinaryInput &input) {
+		state.Add(year, value);
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.YearOverYear(target)) {
+			finalize_data.ReturnNull();
+		}
+	}
+};
+
+//! The base year, a constant argument folded at bind time
+struct RebaseBindData final : FunctionData {
+	explicit RebaseBindData(int64_t base_year) : base_year(base_year) {
+	}
+
+	int64_t base_year;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<RebaseBindData>(base_year);
+	}
+
+	bool Equals(const FunctionData &other) const override {
+		return base_year == other.Cast<RebaseBindData>().base_year;
+	}
+};
+
+struct RebaseOperation : SeriesAggregate {
+	template <class A_TYPE, class B_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const A_TYPE &value, const B_TYPE &year, AggregateBinaryInput &input) {
+		state.Add(year, value, input.input.bind_data->Cast<RebaseBindData>().base_year);
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.Index(target)) {
+			finalize_data.ReturnNull();
+		}
+	}
+};
+
+struct SudanGrowthAggregates {
+
+	static unique_ptr<FunctionData> RebaseBind(ClientContext &context, AggregateFunction &function,
+	                                           vector<unique_ptr<Expression>> &arguments) {
+		if (arguments[2]->HasParameter()) {
+			throw ParameterNotResolvedException();
+		}
+		if (!arguments[2]->IsFoldable()) {
+			throw InvalidInputException("SUDAN: SUDAN_Rebase base year must be a constant");
+		}
+		auto base_year = ExpressionExecutor::EvaluateScalar(context, *arguments[2]);
+		if (base_year.IsNull()) {
+			throw InvalidInputException("SUDAN: SUDAN_Rebase base year cannot be NULL");
+		}
+		// The aggregate itself only sees (value, year)
+		Function::EraseArgument(function, arguments, 2);
+		return make_uniq<RebaseBindData>(base_year.GetValue<int64_t>());
+	}
+
+	template <class STATE, class OP>
+	static AggregateFunction SeriesFunction(const string &name) {
+		auto function = AggregateFunction::BinaryAggregate<STATE, double, int64_t, double, OP>(
+		    LogicalType::DOUBLE, LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.name = name;
+		return function;
+	}
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "aggregate");
+
+		auto cagr = SeriesFunction<sudan::SeriesEndpoints, CAGROperation>("SUDAN_CAGR");
+		RegisterFunction<AggregateFunction>(loader, cagr, CatalogType::AGGREGATE_FUNCTION_ENTRY, R"(
+			Compound annual growth rate between the earliest and latest year: (last / first) ^ (1 / years) - 1.
+			NULL without two years or with a non-positive endpoint.
+		)",
+		                                    R"(
+			SELECT country, SUDAN_CAGR(value, year) FROM SUDAN_WorldBank('NY.GDP.MKTP.CD') GROUP BY country;
+		)",
+		                                    tags);
+
+		auto growth = SeriesFunction<sudan::SeriesLatestPair, GrowthOperation>("SUDAN_Growth");
+		RegisterFunction<AggregateFunction>(loader, growth, CatalogType::AGGREGATE_FUNCTION_ENTRY, R"(
+			Year-over-year growth of the latest year: latest / previous - 1. NULL unless the previous year is present.
+			Over a window ordered by year, the growth of each row.
+		)",
+		                                    R"(
+			SELECT country, year, SUDAN_Growth(value, year) OVER (PARTITION BY country ORDER BY year)
+			FROM SUDAN_WorldBank('SP.POP.TOTL');
+		)",
+		                                    tags);
+
+		auto rebase = SeriesFunction<sudan::SeriesRebase, RebaseOperation>("SUDAN_Rebase");
+		rebase.arguments.push_back(LogicalType::BIGINT);
+		rebase.bind = RebaseBind;
+		RegisterFunction<AggregateFunction>(loader, rebase, CatalogType::AGGREGATE_FUNCTION_ENTRY, R"(
+			Index of the latest year with the base year at 100: 100 * latest / value in base year. Over a window
+			ordered by year, the index of each row from the base year on.
+		)",
+		                                    R"(
+			SELECT country, year, SUDAN_Rebase(value, year, 2015) OVER (PARTITION BY country ORDER BY year)
+			FROM SUDAN_WorldBank('NY.GDP.MKTP.KD');
+		)",
+		                                    tags);
+	}
+};
+
+//======================================================================================================================
+// SUDAN_Trend (Aggregate Function)
+//======================================================================================================================
+
+//! Linear or log-linear model, a constant argument folded at bind time
+struct TrendBindData final : FunctionData {
+	explicit TrendBindData(bool log_linear) : log_linear(log_linear) {
+	}
+
+	bool log_linear;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<TrendBindData>(log_linear);
+	}
+
+	bool Equals(const FunctionData &other) const override {
+		return log_linear == other.Cast<TrendBindData>().log_linear;
+	}
+};
+
+struct TrendOperation : SeriesAggregate {
+	template <class A_TYPE, class B_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const A_TYPE &value, const B_TYPE &year, AggregateBinaryInput &input) {
+		if (!input.input.bind_data->Cast<TrendBindData>().log_linear) {
+			state.Add(year, value);
+		} else if (value > 0) {
+			// Log-linear: a straight line through log values, i.e. constant growth
+			state.Add(year, std::log(value));
+		}
+	}
+};
+
+struct SudanTrend {
+
+	static LogicalType ReturnType() {
+		child_list_t<LogicalType> children;
+		children.emplace_back("slope", LogicalType::DOUBLE);
+		children.emplace_back("intercept", LogicalType::DOUBLE);
+		children.emplace_back("r2", LogicalType::DOUBLE);
+		children.emplace_back("observations", LogicalType::BIGINT);
+		children.emplace_back("forecast_year", LogicalType::BIGINT);
+		children.emplace_back("forecast", LogicalType::DOUBLE);
+		return LogicalType::STRUCT(std::move(children));
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, AggregateFunction &function,
+	                                     vector<unique_ptr<Expression>> &arguments) {
+		if (arguments.size() == 2) {
+			return make_uniq<TrendBindData>(false);
+		}
+		if (arguments[2]->HasParameter()) {
+			throw ParameterNotResolvedException();
+		}
+		if (!arguments[2]->IsFoldable()) {
+			throw InvalidInputException("SUDAN: SUDAN_Trend model must be a constant");
+		}
+		auto model = ExpressionExecutor::EvaluateScalar(context, *arguments[2]);
+		auto name = model.IsNull() ? string() : StringUtil::Lower(StringValue::Get(model));
+		if (name != "linear" && name != "log") {
+			throw InvalidInputException("SUDAN: SUDAN_Trend model must be 'linear' or 'log', got '%s'",
+			                            model.ToString());
+		}
+		Function::EraseArgument(function, arguments, 2);
+		return make_uniq<TrendBindData>(name == "log");
+	}
+
+	static void Finalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+	                     idx_t offset) {
+		auto log_linear = aggr_input_data.bind_data->Cast<TrendBindData>().log_linear;
+		UnifiedVectorFormat state_format;
+		states.ToUnifiedFormat(count, state_format);
+		auto state_data = UnifiedVectorFormat::GetData<sudan::TrendState *>(state_format);
+
+		auto &children = StructVector::GetEntries(result);
+		auto slope = FlatVector::GetData<double>(*children[0]);
+		auto intercept = FlatVector::GetData<double>(*children[1]);
+		auto r2 = FlatVector::GetData<double>(*children[2]);
+		auto observations = FlatVector::GetData<int64_t>(*children[3]);
+		auto forecast_year = FlatVector::GetData<int64_t>(*children[4]);
+		auto forecast = FlatVector::GetData<double>(*children[5]);
+
+		for (idx_t i = 0; i < count; i++) {
+			auto &state = *state_data[state_format.sel->get_index(i)];
+			auto row = i + offset;
+			sudan::TrendFit fit;
+			if (!state.Fit(fit)) {
+				FlatVector::SetNull(result, row, true);
+				continue;
+			}
+			slope[row] = fit.slope;
+			intercept[row] = fit.intercept;
+			r2[row] = fit.r2;
+			observations[row] = static_cast<int64_t>(state.count);
+			// Nowcast: the year after the latest observation
+			forecast_year[row] = state.last_year + 1;
+			auto estimate = fit.intercept + fit.slope * static_cast<double>(forecast_year[row]);
+			forecast[row] = log_linear ? std::exp(estimate) : estimate;
+		}
+	}
+
+	static AggregateFunction TrendFunction() {
+		using STATE = sudan::TrendState;
+		return AggregateFunction(
+		    "SUDAN_Trend", {LogicalType::DOUBLE, LogicalType::BIGINT}, ReturnType(), AggregateFunction::StateSize<STATE>,
+		    AggregateFunction::StateInitialize<STATE, TrendOperation>,
+		    AggregateFunction::BinaryScatterUpdate<STATE, double, int64_t, TrendOperation>,
+		    AggregateFunction::StateCombine<STATE, TrendOperation>, Finalize,
+		    AggregateFunction::BinaryUpdate<STATE, double, int64_t, TrendOperation>, Bind);
+	}
+
+	static constexpr auto DESCRIPTION = R"(
+		Least squares trend of an annual series: slope, intercept, r2, the number of observations, and a forecast
+		for the year after the latest observation. model 'log' fits log values (constant growth, positive values
+		only); the slope is then the continuous growth rate.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT country, SUDAN_Trend(value, year, 'log').forecast
+		FROM SUDAN_WorldBank('SP.POP.TOTL', countries := ['SDN', 'SSD']) WHERE year >= 2010 GROUP BY country;
+	)";
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "aggregate");
+
+		AggregateFunctionSet set("SUDAN_Trend");
+		auto linear = TrendFunction();
+		set.AddFunction(linear);
+		auto with_model = TrendFunction();
+		with_model.arguments.push_back(LogicalType::VARCHAR);
+		set.AddFunction(with_model);
+
+		RegisterFunction<AggregateFunctionSet>(loader, set, CatalogType::AGGREGATE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE,
+		                                       tags);
+	}
+};
+
+//======================================================================================================================
+// SUDAN_Convert (Scalar Function)
+//======================================================================================================================
+
+enum class ConversionTarget : uint8_t { CONSTANT_2015_USD, PER_CAPITA };
+
+//! The conversion, a constant argument folded at bind time
+struct ConvertBindData final : FunctionData {
+	explicit ConvertBindData(ConversionTarget target) : target(target) {
+	}
+
+	ConversionTarget target;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ConvertBindData>(target);
+	}
+
+	bool Equals(const FunctionData &other) const override {
+		return target == other.Cast<ConvertBindData>().target;
+	}
+};
+
+struct SudanConvert {
+
+	using Series = sudan::ConversionTable::Series;
+
+	static constexpr int64_t BASE_YEAR = 2015;
+	//! The v2 API accepts semicolon-separated country lists
+	static constexpr idx_t BATCH_SIZE = 50;
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, ScalarFunction &bound_function,
+	                                     vector<unique_ptr<Expression>> &arguments) {
+		if (arguments[3]->HasParameter()) {
+			throw ParameterNotResolvedException();
+		}
+		if (!arguments[3]->IsFoldable()) {
+			throw InvalidInputException("SUDAN: SUDAN_Convert target must be a constant");
+		}
+		auto target = ExpressionExecutor::EvaluateScalar(context, *arguments[3]);
+		auto name = target.IsNull() ? string() : StringUtil::Lower(StringValue::Get(target));
+		unique_ptr<FunctionData> bind_data;
+		if (name == "const2015usd") {
+			bind_data = make_uniq<ConvertBindData>(ConversionTarget::CONSTANT_2015_USD);
+		} else if (name == "per_capita") {
+			bind_data = make_uniq<ConvertBindData>(ConversionTarget::PER_CAPITA);
+		} else {
+			throw InvalidInputException("SUDAN: SUDAN_Convert target must be 'const2015usd' or 'per_capita', got '%s'",
+			                            target.ToString());
+		}
+		Function::EraseArgument(bound_function, arguments, 3);
+		return bind_data;
+	}
+
+	static vector<Series> RequiredSeries(ConversionTarget target) {
+		if (target == ConversionTarget::PER_CAPITA) {
+			return {Series::POPULATION};
+		}
+		return {Series::EXCHANGE_RATE, Series::DEFLATOR};
+	}
+
+	//! Fetch all years of a series for a batch of countries into the conversion table. Countries stay unloaded if a
+	//! request fails, so a later query tries again.
+	static void LoadBatch(const HttpSettings &settings, Series series, const vector<idx_t> &countries) {
+		vector<string> codes;
+		for (auto country : countries) {
+			codes.emplace_back(sudan::GetCountry(country).iso3);
+		}
+		string base_url = "https://api.worldbank.org/v2/country/" + StringUtil::Join(codes, ";") + "/indicator/" +
+		                  sudan::ConversionTable::IndicatorCode(series);
+
+		unordered_map<idx_t, vector<pair<int64_t, double>>> values;
+		int page = 1;
+		int total_pages = 1;
+		while (page <= total_pages) {
+			string body;
+			if (!FetchCached(settings, base_url + "?format=json&per_page=1000&page=" + std::to_string(page), body)) {
+				return;
+			}
+			auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
+			if (!json_data) {
+				return;
+			}
+			auto root_val = yyjson_doc_get_root(json_data);
+			// World Bank V2 API returns an array: [metadata, data]. Anything else is an error message, such as a
+			// rejected country code: nothing is loaded, so a later query tries again.
+			if (!yyjson_is_arr(root_val) || yyjson_arr_size(root_val) < 2) {
+				yyjson_doc_free(json_data);
+				return;
+			}
+			auto pages_val = yyjson_obj_get(yyjson_arr_get(root_val, 0), "pages");
+			if (yyjson_is_int(pages_val)) {
+				total_pages = yyjson_get_int(pages_val);
+			}
+			size_t idx, max;
+			yyjson_val *elem;
+			yyjson_arr_foreach(yyjson_arr_get(root_val, 1), idx, max, elem) {
+				auto country_id = yyjson_obj_get(yyjson_obj_get(elem, "country"), "id");
+				auto date = yyjson_obj_get(elem, "date");
+				auto value = yyjson_obj_get(elem, "value");
+				if (!yyjson_is_str(country_id) || !yyjson_is_str(date) || !yyjson_is_num(value)) {
+					continue;
+				}
+				auto country = sudan::FindCountry(yyjson_get_str(country_id));
+				if (country) {
+					values[static_cast<idx_t>(country - &sudan::GetCountry(0))].emplace_back(
+					    ParseYear(yyjson_get_str(date)), yyjson_get_num(value));
+				}
+			}
+			yyjson_doc_free(json_data);
+			page++;
+		}
+
+		// Countries without any value are loaded too: the answer will not change on the next query
+		auto &table = sudan::ConversionTable::Instance();
+		for (auto country : countries) {
+			table.Load(series, country, values[country]);
+		}
+	}
+
+	//! Mark the countries the World Bank publishes, from its list of economies. Returns false if the list could not be
+	//! fetched.
+	static bool LoadCoverage(const HttpSettings &settings, vector<bool> &covered) {
+		string body;
+		if (!FetchCached(settings, "https://api.worldbank.org/v2/country?format=json&per_page=1000", body)) {
+			return false;
+		}
+		auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
+		if (!json_data) {
+			return false;
+		}
+		auto root_val = yyjson_doc_get_root(json_data);
+		if (!yyjson_is_arr(root_val) || yyjson_arr_size(root_val) < 2) {
+			yyjson_doc_free(json_data);
+			return false;
+		}
+		covered.assign(sudan::CountryCount(), false);
+		size_t idx, max;
+		yyjson_val *elem;
+		yyjson_arr_foreach(yyjson_arr_get(root_val, 1), idx, max, elem) {
+			auto id = yyjson_obj_get(elem, "id");
+			// Aggregates (regions, income groups) have codes outside ISO 3166-1, or none of their own
+			auto country = yyjson_is_str(id) ? sudan::FindCountryByISO3(yyjson_get_str(id)) : nullptr;
+			if (country) {
+				covered[static_cast<idx_t>(country - &sudan::GetCountry(0))] = true;
+			}
+		}
+		yyjson_doc_free(json_data);
+		return true;
+	}
+
+	//! Load the series the conversion needs for the countries of a chunk, unless an earlier query already did
+	static void LoadMissing(ClientContext &context, ConversionTarget target, const vector<idx_t> &country_indexes) {
+		auto &table = sudan::ConversionTable::Instance();
+		// One loader at a time, so concurrent queries wait for a load in flight instead of repeating it
+		static std::mutex load_mutex;
+		// Countries the World Bank publishes, guarded by load_mutex. Empty until its list of economies is fetched.
+		static vector<bool> covered;
+		unique_ptr<HttpSettings> settings;
+		for (auto series : RequiredSeries(target)) {
+			vector<idx_t> missing;
+			for (auto country : country_indexes) {
+				if (country != DConstants::INVALID_INDEX && !table.IsLoaded(series, country) &&
+				    std::find(missing.begin(), missing.end(), country) == missing.end()) {
+					missing.push_back(country);
+				}
+			}
+			if (missing.empty()) {
+				continue;
+			}
+			std::lock_guard<std::mutex> guard(load_mutex);
+			if (!settings) {
+				settings = make_uniq<HttpSettings>(HttpClient::ExtractHttpSettings(context, "https://api.worldbank.org"));
+			}
+			if (covered.empty() && !LoadCoverage(*settings, covered)) {
+				// Without the list, one territory the API rejects would fail its whole batch
+				return;
+			}
+			vector<idx_t> batch;
+			for (auto country : missing) {
+				if (table.IsLoaded(series, country)) {
+					continue;
+				}
+				if (!covered[country]) {
+					// Not published by the World Bank: no values, and no request on the next query either
+					table.Load(series, country, {});
+					continue;
+				}
+				batch.push_back(country);
+				if (batch.size() == BATCH_SIZE) {
+					LoadBatch(*settings, series, batch);
+					batch.clear();
+				}
+			}
+			if (!batch.empty()) {
+				LoadBatch(*settings, series, batch);
+			}
+		}
+	}
+
+	static bool Convert(ConversionTarget target, idx_t country, int64_t year, double value, double &result) {
+		auto &table = sudan::ConversionTable::Instance();
+		if (target == ConversionTarget::PER_CAPITA) {
+			double population;
+			if (!table.Get(Series::POPULATION, country, year, population) || population <= 0) {
+				return false;
+			}
+			result = value / population;
+			return true;
+		}
+		// Current US$ to local currency at the year's rate, to base year prices with the deflator, and back to US$ at
+		// the base year's rate
+		double rate, base_rate, deflator, base_deflator;
+		if (!table.Get(Series::EXCHANGE_RATE, country, year, rate) ||
+		    !table.Get(Series::EXCHANGE_RATE, country, BASE_YEAR, base_rate) ||
+		    !table.Get(Series::DEFLATOR, country, year, deflator) ||
+		    !table.Get(Series::DEFLATOR, country, BASE_YEAR, base_deflator) || base_rate == 0 || deflator == 0) {
+			return false;
+		}
+		result = value * rate / base_rate * base_deflator / deflator;
+		return true;
+	}
+
+	static void Execute(DataChunk &args, ExpressionState &state, Vector &result) {
+		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+		auto target = func_expr.bind_info->Cast<ConvertBindData>().target;
+		auto count = args.size();
+
+		UnifiedVectorFormat value_format, country_format, year_format;
+		args.data[0].ToUnifiedFormat(count, value_format);
+		args.data[1].ToUnifiedFormat(count, country_format);
+		args.data[2].ToUnifiedFormat(count, year_format);
+		auto values = UnifiedVectorFormat::GetData<double>(value_format);
+		auto countries = UnifiedVectorFormat::GetData<string_t>(country_format);
+		auto years = UnifiedVectorFormat::GetData<int64_t>(year_format);
+
+		// ISO3, ISO2 or M49 codes to table indexes, looking up each run of equal codes once
+		vector<idx_t> country_indexes(count, DConstants::INVALID_INDEX);
+		string previous_code;
+		auto previous_index = DConstants::INVALID_INDEX;
+		for (idx_t i = 0; i < count; i++) {
+			auto country_idx = country_format.sel->get_index(i);
+			if (!country_format.validity.RowIsValid(country_idx)) {
+				continue;
+			}
+			auto code = countries[country_idx].GetString();
+			if (code != previous_code || previous_code.empty()) {
+				auto country = sudan::FindCountry(code);
+				previous_code = code;
+				previous_index = country ? static_cast<idx_t>(country - &sudan::GetCountry(0)) : DConstants::INVALID_INDEX;
+			}
+			country_indexes[i] = previous_index;
+		}
+		LoadMissing(state.GetContext(), target, country_indexes);
+
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		auto result_data = FlatVector::GetData<double>(result);
+		auto &result_validity = FlatVector::Validity(result);
+		for (idx_t i = 0; i < count; i++) {
+			auto value_idx = value_format.sel->get_index(i);
+			auto year_idx = year_format.sel->get_index(i);
+			if (country_indexes[i] == DConstants::INVALID_INDEX || !value_format.validity.RowIsValid(value_idx) ||
+			    !year_format.validity.RowIsValid(year_idx) ||
+			    !Convert(target, country_indexes[i], years[year_idx], values[value_idx], result_data[i])) {
+				result_validity.SetInvalid(i);
+			}
+		}
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+	}
+
+	static constexpr auto DESCRIPTION = R"(
+		Converts a value of a country and year with World Bank series: 'per_capita' divides by the population,
+		'const2015usd' turns current US$ into constant 2015 US$ (GDP deflator, official exchange rates). The series
+		are fetched once per country and kept in memory, so later conversions need no request.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT country, year, SUDAN_Convert(value, country, year, 'const2015usd') AS gdp_2015usd
+		FROM SUDAN_WorldBank('NY.GDP.MKTP.CD', countries := ['SDN', 'EGY']);
+	)";
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "scalar");
+
+		ScalarFunction func("SUDAN_Convert",
+		                    {LogicalType::DOUBLE, LogicalType::VARCHAR, LogicalType::BIGINT, LogicalType::VARCHAR},
+		                    LogicalType::DOUBLE, Execute, Bind);
+
+		RegisterFunction<ScalarFunction>(loader, func, CatalogType::SCALAR_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+	}
+};
+
+} // namespace
+
+//======================================================================================================================
+// Register Analytics Functions
+//======================================================================================================================
+
+void AnalyticsFunctions::Register(ExtensionLoader &loader) {
+	SudanFill::Register(loader);
+	SudanGrowthAggregates::Register(loader);
+	SudanTrend::Register(loader);
+	SudanConvert::Register(loader);
+}
+
+} // namespace duckdb
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace duckdb {
+
+class ExtensionLoader;
+
+struct AnalyticsFunctions {
+public:
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
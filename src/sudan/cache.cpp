@@ -1,17 +1,215 @@
 #include "cache.hpp"
 
+#include <algorithm>
+#include <functional>
+
 namespace sudan {
 
+//======================================================================================================================
+// FrequencySketch
+//======================================================================================================================
+
+// Counters are halved after this many increments per counter column, so the sketch tracks recent popularity
+static constexpr size_t SAMPLE_FACTOR = 10;
+
+FrequencySketch::FrequencySketch(size_t width) : additions_(0) {
+	size_t rounded = 64;
+	while (rounded < width) {
+		rounded <<= 1;
+	}
+	counters_.assign(rounded * DEPTH, 0);
+	width_mask_ = rounded - 1;
+	sample_size_ = rounded * SAMPLE_FACTOR;
+}
+
+size_t FrequencySketch::Index(size_t hash, size_t row) const {
+	// An independent hash per row from a single string hash: seed it per row and mix (splitmix64 finalizer)
+	uint64_t mixed = static_cast<uint64_t>(hash) + (row + 1) * 0x9E3779B97F4A7C15ULL;
+	mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+	mixed ^= mixed >> 31;
+	return row * (width_mask_ + 1) + static_cast<size_t>(mixed & width_mask_);
+}
+
+void FrequencySketch::Increment(const std::string &key) {
+	auto hash = std::hash<std::string>()(key);
+	for (size_t row = 0; row < DEPTH; row++) {
+		auto &counter = counters_[Index(hash, row)];
+		if (counter < MAX_COUNT) {
+			counter++;
+		}
+	}
+	if (++additions_ >= sample_size_) {
+		for (auto &counter : counters_) {
+			counter >>= 1;
+		}
+		additions_ /= 2;
+	}
+}
+
+uint8_t FrequencySketch::Estimate(const std::string &key) const {
+	auto hash = std::hash<std::string>()(key);
+	uint8_t estimate = MAX_COUNT;
+	for (size_t row = 0; row < DEPTH; row++) {
+		estimate = std::min(estimate, counters_[Index(hash, row)]);
+	}
+	return estimate;
+}
+
+//======================================================================================================================
+// ResponseCache
+//======================================================================================================================
+
+// Expected distinct URLs between sketch resets: a cache full of 64 KiB responses
+static constexpr uint64_t SKETCH_ENTRY_BYTES = 64 * 1024;
+
+ResponseCache::ResponseCache(uint64_t capacity_bytes)
+    : window_bytes_(0), probation_bytes_(0), protected_bytes_(0), capacity_(capacity_bytes),
+      sketch_(static_cast<size_t>(std::max<uint64_t>(capacity_bytes / SKETCH_ENTRY_BYTES, 4096))) {
+}
+
+std::list<std::string> &ResponseCache::List(Segment segment) {
+	switch (segment) {
+	case Segment::WINDOW:
+		return window_;
+	case Segment::PROBATION:
+		return probation_;
+	default:
+		return protected_;
+	}
+}
+
+uint64_t &ResponseCache::Bytes(Segment segment) {
+	switch (segment) {
+	case Segment::WINDOW:
+		return window_bytes_;
+	case Segment::PROBATION:
+		return probation_bytes_;
+	default:
+		return protected_bytes_;
+	}
+}
+
+uint64_t ResponseCache::EntrySize(const std::string &url, const std::string &body) {
+	return url.size() + body.size();
+}
+
+void ResponseCache::MoveTo(entry_iterator entry, Segment segment) {
+	auto &value = entry->second;
+	auto size = EntrySize(entry->first, value.body);
+	auto &from = List(value.segment);
+	auto &to = List(segment);
+	to.splice(to.end(), from, value.position);
+	Bytes(value.segment) -= size;
+	Bytes(segment) += size;
+	value.segment = segment;
+}
+
+void ResponseCache::Erase(entry_iterator entry) {
+	auto &value = entry->second;
+	Bytes(value.segment) -= EntrySize(entry->first, value.body);
+	List(value.segment).erase(value.position);
+	cache_.erase(entry);
+}
+
+void ResponseCache::Touch(entry_iterator entry) {
+	// Hit twice in the main cache: protected from the next scan
+	auto segment = entry->second.segment == Segment::PROBATION ? Segment::PROTECTED : entry->second.segment;
+	MoveTo(entry, segment);
+	Evict();
+}
+
+void ResponseCache::Evict() {
+	auto window_capacity = capacity_ * WINDOW_PERCENT / 100;
+	auto main_capacity = capacity_ - window_capacity;
+	auto protected_capacity = main_capacity * PROTECTED_PERCENT / 100;
+
+	// Protected overflow goes back on probation, where it competes with new entries again
+	while (protected_bytes_ > protected_capacity && !protected_.empty()) {
+		MoveTo(cache_.find(protected_.front()), Segment::PROBATION);
+	}
+
+	// Entries leaving the window are candidates for the main cache
+	while (window_bytes_ > window_capacity && !window_.empty()) {
+		auto candidate = cache_.find(window_.front());
+		auto candidate_size = EntrySize(candidate->first, candidate->second.body);
+		if (candidate_size > main_capacity) {
+			Erase(candidate);
+			continue;
+		}
+
+		// The least recently used main entries that would have to make room, probation first. The candidate is
+		// admitted only if it is requested more often than every one of them.
+		auto main_bytes = probation_bytes_ + protected_bytes_;
+		auto candidate_frequency = sketch_.Estimate(candidate->first);
+		std::vector<std::string> victims;
+		uint64_t freed = 0;
+		bool admit = true;
+		for (auto segment : {Segment::PROBATION, Segment::PROTECTED}) {
+			auto &list = List(segment);
+			for (auto it = list.begin(); it != list.end() && main_bytes + candidate_size - freed > main_capacity;
+			     ++it) {
+				if (sketch_.Estimate(*it) >= candidate_frequency) {
+					admit = false;
+					break;
+				}
+				freed += EntrySize(*it, cache_.find(*it)->second.body);
+				victims.push_back(*it);
+			}
+			if (!admit) {
+				break;
+			}
+		}
+
+		if (!admit) {
+			Erase(candidate);
+			continue;
+		}
+		for (auto &victim : victims) {
+			Erase(cache_.find(victim));
+		}
+		MoveTo(candidate, Segment::PROBATION);
+	}
+
+	// A shrunk capacity can leave the main cache over budget even without new entries
+	while (probation_bytes_ + protected_bytes_ > main_capacity) {
+		auto &list = probation_.empty() ? protected_ : probation_;
+		Erase(cache_.find(list.front()));
+	}
+}
+
 std::string ResponseCache::Get(const std::string &url) {
 	std::lock_guard<std::mutex> lock(mutex_);
+	// Misses count too: a URL requested again and again earns its place once it is fetched
+	sketch_.Increment(url);
 	auto it = cache_.find(url);
 	if (it == cache_.end()) {
 		return "";
 	}
 	auto now = std::chrono::steady_clock::now();
 	auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.timestamp).count();
+	if (elapsed > STALE_TTL_SECONDS) {
+		Erase(it);
+		return "";
+	}
 	if (elapsed > CACHE_TTL_SECONDS) {
-		cache_.erase(it);
+		return "";
+	}
+	auto body = it->second.body;
+	Touch(it);
+	return body;
+}
+
+std::string ResponseCache::GetStale(const std::string &url, int64_t &age_seconds) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = cache_.find(url);
+	if (it == cache_.end()) {
+		return "";
+	}
+	auto now = std::chrono::steady_clock::now();
+	age_seconds = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.timestamp).count();
+	if (age_seconds > STALE_TTL_SECONDS) {
+		Erase(it);
 		return "";
 	}
 	return it->second.body;
@@ -19,15 +217,93 @@ std::string ResponseCache::Get(const std::string &url) {
 
 void ResponseCache::Put(const std::string &url, const std::string &body) {
 	std::lock_guard<std::mutex> lock(mutex_);
-	CacheEntry entry;
-	entry.body = body;
+	if (EntrySize(url, body) > capacity_) {
+		return;
+	}
+
+	auto it = cache_.find(url);
+	if (it != cache_.end()) {
+		// Refreshed response: keep the entry's segment
+		auto &value = it->second;
+		Bytes(value.segment) += EntrySize(url, body);
+		Bytes(value.segment) -= EntrySize(url, value.body);
+		value.body = body;
+		value.timestamp = std::chrono::steady_clock::now();
+		MoveTo(it, value.segment);
+	} else {
+		CacheEntry entry;
+		entry.body = body;
+		entry.timestamp = std::chrono::steady_clock::now();
+		entry.segment = Segment::WINDOW;
+		entry.position = window_.insert(window_.end(), url);
+		window_bytes_ += EntrySize(url, body);
+		cache_.emplace(url, std::move(entry));
+	}
+	Evict();
+}
+
+void ResponseCache::PutMiss(const std::string &url, const std::string &warning) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = misses_.find(url);
+	if (it != misses_.end()) {
+		miss_order_.erase(it->second.position);
+		misses_.erase(it);
+	}
+	MissEntry entry;
+	entry.warning = warning;
 	entry.timestamp = std::chrono::steady_clock::now();
-	cache_[url] = std::move(entry);
+	entry.position = miss_order_.insert(miss_order_.end(), url);
+	misses_.emplace(url, std::move(entry));
+	// Oldest first, so the entries dropped are the closest to expiring
+	while (misses_.size() > MAX_MISSES) {
+		misses_.erase(miss_order_.front());
+		miss_order_.pop_front();
+	}
+}
+
+bool ResponseCache::GetMiss(const std::string &url, uint64_t ttl_seconds, std::string &warning,
+                            int64_t &age_seconds) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = misses_.find(url);
+	if (it == misses_.end()) {
+		return false;
+	}
+	auto now = std::chrono::steady_clock::now();
+	age_seconds = std::chrono::duration_cast<std::chrono::seconds>(now - it->second.timestamp).count();
+	if (age_seconds >= static_cast<int64_t>(ttl_seconds)) {
+		miss_order_.erase(it->second.position);
+		misses_.erase(it);
+		return false;
+	}
+	warning = it->second.warning;
+	return true;
+}
+
+void ResponseCache::SetCapacity(uint64_t capacity_bytes) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	if (capacity_bytes == capacity_) {
+		return;
+	}
+	capacity_ = capacity_bytes;
+	Evict();
+}
+
+uint64_t ResponseCache::Size() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return window_bytes_ + probation_bytes_ + protected_bytes_;
 }
 
 void ResponseCache::Clear() {
 	std::lock_guard<std::mutex> lock(mutex_);
 	cache_.clear();
+	window_.clear();
+	probation_.clear();
+	protected_.clear();
+	window_bytes_ = 0;
+	probation_bytes_ = 0;
+	protected_bytes_ = 0;
+	misses_.clear();
+	miss_order_.clear();
 }
 
 ResponseCache &ResponseCache::Instance() {
@@ -2,36 +2,139 @@
 
 #include <string>
 #include <unordered_map>
+#include <list>
+#include <vector>
 #include <mutex>
 #include <chrono>
+#include <cstdint>
 
 namespace sudan {
 
-//! Simple in-memory response cache for API responses within a session
-class ResponseCache {
+//! Count-min sketch of recent key frequencies with 4-bit counters, halved periodically so old popularity fades.
+//! Estimates are approximate (only ever too high) and capped at 15, enough to rank admission candidates.
+class FrequencySketch {
 public:
-	struct CacheEntry {
-		std::string body;
-		std::chrono::steady_clock::time_point timestamp;
-	};
+	explicit FrequencySketch(size_t width);
+
+	//! Count an access to the key
+	void Increment(const std::string &key);
+
+	//! Estimated accesses to the key since about the last reset
+	uint8_t Estimate(const std::string &key) const;
+
+private:
+	static constexpr size_t DEPTH = 4;
+	static constexpr uint8_t MAX_COUNT = 15;
 
+	size_t Index(size_t hash, size_t row) const;
+
+	std::vector<uint8_t> counters_;
+	size_t width_mask_;
+	//! Increments since the last halving, reset after SAMPLE_FACTOR * width
+	size_t additions_;
+	size_t sample_size_;
+};
+
+//! In-memory response cache for API responses, shared by all connections and bounded in bytes.
+//!
+//! Admission follows W-TinyLFU: new responses enter a small LRU window. Responses leaving the window only displace
+//! an entry of the main segmented LRU if they were requested more often, as estimated by a frequency sketch of all
+//! lookups. A one-off sweep (e.g. the full indicator catalog) passes through the window without flushing responses
+//! that recurring queries hit.
+class ResponseCache {
+public:
 	//! Get a cached response for the given URL. Returns empty string if not found or expired.
 	std::string Get(const std::string &url);
 
-	//! Store a response in the cache
+	//! Get a cached response even if it expired, as a fallback while its provider is unreachable. Returns empty
+	//! string if not found or older than the stale limit; age_seconds receives the age of the entry.
+	std::string GetStale(const std::string &url, int64_t &age_seconds);
+
+	//! Store a response in the cache. Responses larger than the whole cache are not stored.
 	void Put(const std::string &url, const std::string &body);
 
+	//! Remember that a URL failed or returned nothing, so requests for it within the negative TTL are skipped.
+	//! warning is repeated to queries that hit the entry, empty if the miss is not worth a warning (e.g. 404).
+	void PutMiss(const std::string &url, const std::string &warning);
+
+	//! Whether the URL failed within the last ttl_seconds. warning and age_seconds receive the stored warning and
+	//! the age of the entry.
+	bool GetMiss(const std::string &url, uint64_t ttl_seconds, std::string &warning, int64_t &age_seconds);
+
+	//! Change the byte budget, evicting entries if it shrank
+	void SetCapacity(uint64_t capacity_bytes);
+
+	//! Bytes held by cached responses
+	uint64_t Size();
+
 	//! Clear the cache
 	void Clear();
 
 	//! Get the singleton instance
 	static ResponseCache &Instance();
 
+	explicit ResponseCache(uint64_t capacity_bytes = DEFAULT_CAPACITY);
+
+	static constexpr uint64_t DEFAULT_CAPACITY = 256ULL * 1024 * 1024;
+
 private:
+	//! Window for new entries, then the main cache: probation for entries admitted once, protected for entries hit
+	//! again while on probation
+	enum class Segment : uint8_t { WINDOW, PROBATION, PROTECTED };
+
+	struct CacheEntry {
+		std::string body;
+		std::chrono::steady_clock::time_point timestamp;
+		Segment segment;
+		//! Position of the URL in its segment's LRU list
+		std::list<std::string>::iterator position;
+	};
+
+	typedef std::unordered_map<std::string, CacheEntry>::iterator entry_iterator;
+
+	std::list<std::string> &List(Segment segment);
+	uint64_t &Bytes(Segment segment);
+	static uint64_t EntrySize(const std::string &url, const std::string &body);
+
+	//! Move an entry to the most recently used end of a segment
+	void MoveTo(entry_iterator entry, Segment segment);
+	void Erase(entry_iterator entry);
+	//! A hit: promote probation entries, refresh the LRU position of the others
+	void Touch(entry_iterator entry);
+	//! Restore the segment budgets after an insert, a promotion or a capacity change
+	void Evict();
+
 	std::unordered_map<std::string, CacheEntry> cache_;
+	std::list<std::string> window_;
+	std::list<std::string> probation_;
+	std::list<std::string> protected_;
+	uint64_t window_bytes_;
+	uint64_t probation_bytes_;
+	uint64_t protected_bytes_;
+	uint64_t capacity_;
+	FrequencySketch sketch_;
+
+	//! Negative entries, with the warning in place of the body. Kept apart so a miss never shadows a stale
+	//! response that can still serve as a fallback. The TTL is a per-query setting, so expired entries are only known
+	//! on lookup; the oldest are dropped beyond MAX_MISSES instead.
+	struct MissEntry {
+		std::string warning;
+		std::chrono::steady_clock::time_point timestamp;
+		//! Position of the URL in miss_order_
+		std::list<std::string>::iterator position;
+	};
+	std::unordered_map<std::string, MissEntry> misses_;
+	//! URLs of misses, oldest first
+	std::list<std::string> miss_order_;
 	std::mutex mutex_;
-	// Cache entries expire after 5 minutes
+	// Cache entries expire after 5 minutes, but are kept as stale fallbacks for a day
 	static constexpr int CACHE_TTL_SECONDS = 300;
+	static constexpr int STALE_TTL_SECONDS = 86400;
+	//! Misses remembered at most, a few hundred bytes each
+	static constexpr size_t MAX_MISSES = 4096;
+	//! Share of the capacity for the window and, of the main cache, for protected entries
+	static constexpr uint64_t WINDOW_PERCENT = 1;
+	static constexpr uint64_t PROTECTED_PERCENT = 80;
 };
 
 } // namespace sudan
@@ -0,0 +1,337 @@
+#include "sudan_catalog.hpp"
+
+// DuckDB
+#include "duckdb/common/exception.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parser/parsed_data/create_schema_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/parser/parsed_data/drop_info.hpp"
+#include "duckdb/storage/database_size.hpp"
+#include "duckdb/storage/table_storage_info.hpp"
+
+// SUDAN
+#include "sudan/worldbank/wb_functions.hpp"
+#include "sudan/worldbank/wb_indicators.hpp"
+#include "sudan/who/who_functions.hpp"
+#include "sudan/fao/fao_functions.hpp"
+#include "sudan/unhcr/unhcr_functions.hpp"
+#include "sudan/ilo/ilo_functions.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// Catalog Providers
+//======================================================================================================================
+
+// FAO and ILO have no cached catalog to list, their tables are resolved on lookup only. The World Bank catalog is
+// thousands of indicators over many pages, so lookups check a single indicator instead.
+static const SudanCatalogProvider CATALOG_PROVIDERS[] = {
+    {"worldbank", WorldBankFunctions::GetCatalogScan, WorldBankIndicatorFunctions::ListIndicatorIds,
+     WorldBankIndicatorFunctions::IndicatorExists, true},
+    {"who", WHOFunctions::GetCatalogScan, WHOFunctions::ListIndicatorCodes, nullptr, true},
+    {"fao", FAOFunctions::GetCatalogScan, nullptr, FAOFunctions::DatasetExists, false},
+    {"unhcr", UNHCRFunctions::GetCatalogScan, UNHCRFunctions::ListPopulationTypes, nullptr, false},
+    {"ilo", ILOFunctions::GetCatalogScan, nullptr, ILOFunctions::IndicatorExists, false},
+};
+
+static void ThrowReadOnly() {
+	throw BinderException("SUDAN: The attached sudan catalog is read-only.");
+}
+
+//======================================================================================================================
+// SudanTableEntry
+//======================================================================================================================
+
+SudanTableEntry::SudanTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info,
+                                 const SudanCatalogProvider &provider, vector<string> countries)
+    : TableCatalogEntry(catalog, schema, info), provider(provider), countries(std::move(countries)) {
+}
+
+unique_ptr<BaseStatistics> SudanTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
+	// Nothing is known about the remote data before it is fetched, not even its year range. Year filters are pushed
+	// down into the provider request instead.
+	return nullptr;
+}
+
+TableFunction SudanTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
+	vector<LogicalType> return_types;
+	vector<string> names;
+	return provider.get_scan(name, countries, return_types, names, bind_data);
+}
+
+TableStorageInfo SudanTableEntry::GetStorageInfo(ClientContext &context) {
+	TableStorageInfo result;
+	return result;
+}
+
+//======================================================================================================================
+// SudanSchemaEntry
+//======================================================================================================================
+
+SudanSchemaEntry::SudanSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, const SudanCatalogProvider &provider,
+                                   vector<string> countries)
+    : SchemaCatalogEntry(catalog, info), provider(provider), countries(std::move(countries)), listed(false) {
+}
+
+SudanTableEntry &SudanSchemaEntry::GetOrCreateTable(const string &table_name) {
+	auto entry = tables.find(table_name);
+	if (entry != tables.end()) {
+		return *entry->second;
+	}
+
+	// Binding a provider scan is cheap (no network), so tables are materialized on first lookup
+	vector<LogicalType> return_types;
+	vector<string> names;
+	unique_ptr<FunctionData> bind_data;
+	provider.get_scan(table_name, countries, return_types, names, bind_data);
+
+	CreateTableInfo info(*this, table_name);
+	for (idx_t i = 0; i < names.size(); i++) {
+		info.columns.AddColumn(ColumnDefinition(names[i], return_types[i]));
+	}
+	info.internal = false;
+	info.temporary = false;
+
+	auto table = make_uniq<SudanTableEntry>(ParentCatalog(), *this, info, provider, countries);
+	auto &result = *table;
+	tables[table_name] = std::move(table);
+	return result;
+}
+
+void SudanSchemaEntry::Scan(ClientContext &context, CatalogType type,
+                            const std::function<void(CatalogEntry &)> &callback) {
+	if (type != CatalogType::TABLE_ENTRY) {
+		return;
+	}
+
+	// Listing is the only operation that needs the full indicator catalog. Downloading it (and binding a table per
+	// indicator) is opt-in, otherwise a listing shows the tables looked up so far.
+	bool full_listing = !provider.remote_listing;
+	Value listing_setting;
+	if (provider.remote_listing && context.TryGetCurrentSetting("sudan_catalog_listing", listing_setting)) {
+		full_listing = listing_setting.GetValue<bool>();
+	}
+	vector<string> table_names;
+	bool needs_listing;
+	{
+		lock_guard<mutex> guard(entry_lock);
+		needs_listing = !listed && provider.list_tables && full_listing;
+	}
+	if (needs_listing) {
+		table_names = provider.list_tables(context);
+	}
+
+	lock_guard<mutex> guard(entry_lock);
+	if (needs_listing) {
+		for (auto &table_name : table_names) {
+			GetOrCreateTable(table_name);
+		}
+		listed = true;
+	}
+	for (auto &entry : tables) {
+		callback(*entry.second);
+	}
+}
+
+void SudanSchemaEntry::Scan(CatalogType type, const std::function<void(CatalogEntry &)> &callback) {
+	if (type != CatalogType::TABLE_ENTRY) {
+		return;
+	}
+	lock_guard<mutex> guard(entry_lock);
+	for (auto &entry : tables) {
+		callback(*entry.second);
+	}
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::LookupEntry(CatalogTransaction transaction,
+                                                         const EntryLookupInfo &lookup_info) {
+	if (lookup_info.GetCatalogType() != CatalogType::TABLE_ENTRY) {
+		return nullptr;
+	}
+	auto &table_name = lookup_info.GetEntryName();
+	bool needs_listing;
+	{
+		lock_guard<mutex> guard(entry_lock);
+		auto entry = tables.find(table_name);
+		if (entry != tables.end()) {
+			return entry->second.get();
+		}
+		needs_listing = !listed && !provider.table_exists;
+	}
+	if (!transaction.context) {
+		return nullptr;
+	}
+	auto &context = *transaction.context;
+
+	// Check the name with the provider (outside the lock, it may be a request)
+	vector<string> table_names;
+	if (provider.table_exists) {
+		if (!provider.table_exists(context, table_name)) {
+			return nullptr;
+		}
+	} else if (needs_listing) {
+		table_names = provider.list_tables(context);
+	}
+
+	lock_guard<mutex> guard(entry_lock);
+	if (provider.table_exists) {
+		return GetOrCreateTable(table_name);
+	}
+	if (!table_names.empty() && !listed) {
+		// An empty listing is a failed request: list again on the next lookup
+		for (auto &name : table_names) {
+			GetOrCreateTable(name);
+		}
+		listed = true;
+	}
+	auto entry = tables.find(table_name);
+	return entry != tables.end() ? entry->second.get() : nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateIndex(CatalogTransaction transaction, CreateIndexInfo &info,
+                                                         TableCatalogEntry &table) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateFunction(CatalogTransaction transaction, CreateFunctionInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateTable(CatalogTransaction transaction, BoundCreateTableInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateView(CatalogTransaction transaction, CreateViewInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateSequence(CatalogTransaction transaction, CreateSequenceInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateTableFunction(CatalogTransaction transaction,
+                                                                 CreateTableFunctionInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateCopyFunction(CatalogTransaction transaction,
+                                                                CreateCopyFunctionInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreatePragmaFunction(CatalogTransaction transaction,
+                                                                  CreatePragmaFunctionInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateCollation(CatalogTransaction transaction,
+                                                             CreateCollationInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+optional_ptr<CatalogEntry> SudanSchemaEntry::CreateType(CatalogTransaction transaction, CreateTypeInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+void SudanSchemaEntry::DropEntry(ClientContext &context, DropInfo &info) {
+	ThrowReadOnly();
+}
+
+void SudanSchemaEntry::Alter(CatalogTransaction transaction, AlterInfo &info) {
+	ThrowReadOnly();
+}
+
+//======================================================================================================================
+// SudanCatalog
+//======================================================================================================================
+
+SudanCatalog::SudanCatalog(AttachedDatabase &db, vector<string> countries)
+    : Catalog(db), countries(std::move(countries)) {
+}
+
+void SudanCatalog::Initialize(bool load_builtin) {
+	// Schemas are static, attaching never touches the network
+	for (auto &provider : CATALOG_PROVIDERS) {
+		CreateSchemaInfo info;
+		info.schema = provider.schema_name;
+		info.internal = false;
+		schemas[provider.schema_name] = make_uniq<SudanSchemaEntry>(*this, info, provider, countries);
+	}
+}
+
+optional_ptr<CatalogEntry> SudanCatalog::CreateSchema(CatalogTransaction transaction, CreateSchemaInfo &info) {
+	ThrowReadOnly();
+	return nullptr;
+}
+
+void SudanCatalog::ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) {
+	for (auto &provider : CATALOG_PROVIDERS) {
+		callback(*schemas[provider.schema_name]);
+	}
+}
+
+optional_ptr<SchemaCatalogEntry> SudanCatalog::LookupSchema(CatalogTransaction transaction,
+                                                            const EntryLookupInfo &schema_lookup,
+                                                            OnEntryNotFound if_not_found) {
+	auto &schema_name = schema_lookup.GetEntryName();
+	auto entry = schemas.find(schema_name);
+	if (entry != schemas.end()) {
+		return entry->second.get();
+	}
+	if (if_not_found == OnEntryNotFound::RETURN_NULL) {
+		return nullptr;
+	}
+	throw CatalogException("SUDAN: Schema '%s' not found. Available schemas: worldbank, who, fao, unhcr, ilo.",
+	                       schema_name);
+}
+
+PhysicalOperator &SudanCatalog::PlanCreateTableAs(ClientContext &context, PhysicalPlanGenerator &planner,
+                                                  LogicalCreateTable &op, PhysicalOperator &plan) {
+	ThrowReadOnly();
+	return plan;
+}
+
+PhysicalOperator &SudanCatalog::PlanInsert(ClientContext &context, PhysicalPlanGenerator &planner, LogicalInsert &op,
+                                           optional_ptr<PhysicalOperator> plan) {
+	ThrowReadOnly();
+	return *plan;
+}
+
+PhysicalOperator &SudanCatalog::PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner, LogicalDelete &op,
+                                           PhysicalOperator &plan) {
+	ThrowReadOnly();
+	return plan;
+}
+
+PhysicalOperator &SudanCatalog::PlanUpdate(ClientContext &context, PhysicalPlanGenerator &planner, LogicalUpdate &op,
+                                           PhysicalOperator &plan) {
+	ThrowReadOnly();
+	return plan;
+}
+
+DatabaseSize SudanCatalog::GetDatabaseSize(ClientContext &context) {
+	DatabaseSize size;
+	size.total_blocks = 0;
+	size.block_size = 0;
+	size.free_blocks = 0;
+	size.used_blocks = 0;
+	size.bytes = 0;
+	size.wal_size = 0;
+	return size;
+}
+
+void SudanCatalog::DropSchema(ClientContext &context, DropInfo &info) {
+	ThrowReadOnly();
+}
+
+} // namespace duckdb
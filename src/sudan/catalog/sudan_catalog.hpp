@@ -0,0 +1,143 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// Catalog Provider
+//======================================================================================================================
+
+//! Hooks a data provider exposes to the ATTACH catalog: one schema per provider, one table per indicator
+struct SudanCatalogProvider {
+	//! Build the provider scan for a table of this schema
+	typedef TableFunction (*get_scan_t)(const string &table_name, const vector<string> &countries,
+	                                    vector<LogicalType> &return_types, vector<string> &names,
+	                                    unique_ptr<FunctionData> &bind_data);
+	//! List the tables of this schema (nullptr if the provider has no browsable catalog)
+	typedef vector<string> (*list_tables_t)(ClientContext &context);
+	//! Whether a table exists, without listing the schema (nullptr to look the name up in the listing)
+	typedef bool (*table_exists_t)(ClientContext &context, const string &table_name);
+
+	string schema_name;
+	get_scan_t get_scan;
+	list_tables_t list_tables;
+	table_exists_t table_exists;
+	//! Whether listing downloads the provider's catalog, which a schema listing then only does with
+	//! sudan_catalog_listing enabled
+	bool remote_listing;
+};
+
+//======================================================================================================================
+// SudanTableEntry
+//======================================================================================================================
+
+//! A provider indicator exposed as a read-only table
+class SudanTableEntry : public TableCatalogEntry {
+public:
+	SudanTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info,
+	                const SudanCatalogProvider &provider, vector<string> countries);
+
+	unique_ptr<BaseStatistics> GetStatistics(ClientContext &context, column_t column_id) override;
+	TableFunction GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) override;
+	TableStorageInfo GetStorageInfo(ClientContext &context) override;
+
+private:
+	const SudanCatalogProvider &provider;
+	vector<string> countries;
+};
+
+//======================================================================================================================
+// SudanSchemaEntry
+//======================================================================================================================
+
+//! A provider exposed as a read-only schema. Tables are created lazily on the first lookup of a name the provider
+//! knows; the full indicator catalog is only fetched when the schema is listed with sudan_catalog_listing enabled,
+//! or when the provider has no cheaper existence check. Unknown names are not kept, so typos get DuckDB's usual
+//! catalog error.
+class SudanSchemaEntry : public SchemaCatalogEntry {
+public:
+	SudanSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, const SudanCatalogProvider &provider,
+	                 vector<string> countries);
+
+	void Scan(ClientContext &context, CatalogType type, const std::function<void(CatalogEntry &)> &callback) override;
+	void Scan(CatalogType type, const std::function<void(CatalogEntry &)> &callback) override;
+
+	optional_ptr<CatalogEntry> CreateIndex(CatalogTransaction transaction, CreateIndexInfo &info,
+	                                       TableCatalogEntry &table) override;
+	optional_ptr<CatalogEntry> CreateFunction(CatalogTransaction transaction, CreateFunctionInfo &info) override;
+	optional_ptr<CatalogEntry> CreateTable(CatalogTransaction transaction, BoundCreateTableInfo &info) override;
+	optional_ptr<CatalogEntry> CreateView(CatalogTransaction transaction, CreateViewInfo &info) override;
+	optional_ptr<CatalogEntry> CreateSequence(CatalogTransaction transaction, CreateSequenceInfo &info) override;
+	optional_ptr<CatalogEntry> CreateTableFunction(CatalogTransaction transaction,
+	                                               CreateTableFunctionInfo &info) override;
+	optional_ptr<CatalogEntry> CreateCopyFunction(CatalogTransaction transaction,
+	                                              CreateCopyFunctionInfo &info) override;
+	optional_ptr<CatalogEntry> CreatePragmaFunction(CatalogTransaction transaction,
+	                                                CreatePragmaFunctionInfo &info) override;
+	optional_ptr<CatalogEntry> CreateCollation(CatalogTransaction transaction, CreateCollationInfo &info) override;
+	optional_ptr<CatalogEntry> CreateType(CatalogTransaction transaction, CreateTypeInfo &info) override;
+	optional_ptr<CatalogEntry> LookupEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) override;
+	void DropEntry(ClientContext &context, DropInfo &info) override;
+	void Alter(CatalogTransaction transaction, AlterInfo &info) override;
+
+private:
+	//! Get or create the table entry for the given name (caller holds the lock)
+	SudanTableEntry &GetOrCreateTable(const string &table_name);
+
+	const SudanCatalogProvider &provider;
+	vector<string> countries;
+
+	mutex entry_lock;
+	case_insensitive_map_t<unique_ptr<SudanTableEntry>> tables;
+	bool listed;
+};
+
+//======================================================================================================================
+// SudanCatalog
+//======================================================================================================================
+
+//! Read-only catalog for `ATTACH 'sudan:' AS s (TYPE sudan)`
+class SudanCatalog : public Catalog {
+public:
+	SudanCatalog(AttachedDatabase &db, vector<string> countries);
+
+	void Initialize(bool load_builtin) override;
+	string GetCatalogType() override {
+		return "sudan";
+	}
+
+	optional_ptr<CatalogEntry> CreateSchema(CatalogTransaction transaction, CreateSchemaInfo &info) override;
+	void ScanSchemas(ClientContext &context, std::function<void(SchemaCatalogEntry &)> callback) override;
+	optional_ptr<SchemaCatalogEntry> LookupSchema(CatalogTransaction transaction, const EntryLookupInfo &schema_lookup,
+	                                              OnEntryNotFound if_not_found) override;
+
+	PhysicalOperator &PlanCreateTableAs(ClientContext &context, PhysicalPlanGenerator &planner, LogicalCreateTable &op,
+	                                    PhysicalOperator &plan) override;
+	PhysicalOperator &PlanInsert(ClientContext &context, PhysicalPlanGenerator &planner, LogicalInsert &op,
+	                             optional_ptr<PhysicalOperator> plan) override;
+	PhysicalOperator &PlanDelete(ClientContext &context, PhysicalPlanGenerator &planner, LogicalDelete &op,
+	                             PhysicalOperator &plan) override;
+	PhysicalOperator &PlanUpdate(ClientContext &context, PhysicalPlanGenerator &planner, LogicalUpdate &op,
+	                             PhysicalOperator &plan) override;
+
+	DatabaseSize GetDatabaseSize(ClientContext &context) override;
+	bool InMemory() override {
+		return true;
+	}
+	string GetDBPath() override {
+		return "sudan:";
+	}
+
+private:
+	void DropSchema(ClientContext &context, DropInfo &info) override;
+
+	vector<string> countries;
+	case_insensitive_map_t<unique_ptr<SudanSchemaEntry>> schemas;
+};
+
+} // namespace duckdb
@@ -0,0 +1,96 @@
+#include "sudan_storage.hpp"
+#include "sudan_catalog.hpp"
+
+// DuckDB
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/parser/parsed_data/attach_info.hpp"
+#include "duckdb/common/string_util.hpp"
+
+// SUDAN
+#include "sudan/provider_scan.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// SudanTransactionManager
+//======================================================================================================================
+
+SudanTransactionManager::SudanTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
+}
+
+Transaction &SudanTransactionManager::StartTransaction(ClientContext &context) {
+	auto transaction = make_uniq<SudanTransaction>(*this, context);
+	auto &result = *transaction;
+	lock_guard<mutex> guard(transaction_lock);
+	transactions[result] = std::move(transaction);
+	return result;
+}
+
+ErrorData SudanTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction) {
+	lock_guard<mutex> guard(transaction_lock);
+	transactions.erase(transaction);
+	return ErrorData();
+}
+
+void SudanTransactionManager::RollbackTransaction(Transaction &transaction) {
+	lock_guard<mutex> guard(transaction_lock);
+	transactions.erase(transaction);
+}
+
+void SudanTransactionManager::Checkpoint(ClientContext &context, bool force) {
+}
+
+//======================================================================================================================
+// SudanStorageExtension
+//======================================================================================================================
+
+//! Parse the optional COUNTRIES attach option: a list or a comma-separated string of ISO codes or @groups
+static vector<string> ParseAttachCountries(const AttachInfo &info) {
+	vector<string> countries;
+	for (auto &option : info.options) {
+		if (!StringUtil::CIEquals(option.first, "countries") || option.second.IsNull()) {
+			continue;
+		}
+		if (option.second.type().id() == LogicalTypeId::LIST) {
+			for (const auto &item : ListValue::GetChildren(option.second)) {
+				ProviderScanBindData::AddCountries(item.ToString(), countries);
+			}
+		} else {
+			for (auto &code : StringUtil::Split(option.second.ToString(), ',')) {
+				StringUtil::Trim(code);
+				if (!code.empty()) {
+					ProviderScanBindData::AddCountries(code, countries);
+				}
+			}
+		}
+	}
+	if (countries.empty()) {
+		countries.push_back("SDN");
+	}
+	return countries;
+}
+
+static unique_ptr<Catalog> SudanAttach(optional_ptr<StorageExtensionInfo> storage_info, ClientContext &context,
+                                       AttachedDatabase &db, const string &name, AttachInfo &info,
+                                       AttachOptions &options) {
+	return make_uniq<SudanCatalog>(db, ParseAttachCountries(info));
+}
+
+static unique_ptr<TransactionManager> SudanCreateTransactionManager(optional_ptr<StorageExtensionInfo> storage_info,
+                                                                    AttachedDatabase &db, Catalog &catalog) {
+	return make_uniq<SudanTransactionManager>(db);
+}
+
+SudanStorageExtension::SudanStorageExtension() {
+	attach = SudanAttach;
+	create_transaction_manager = SudanCreateTransactionManager;
+}
+
+void SudanStorageFunctions::Register(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	config.storage_extensions["sudan"] = make_uniq<SudanStorageExtension>();
+}
+
+} // namespace duckdb
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/storage/storage_extension.hpp"
+#include "duckdb/transaction/transaction.hpp"
+#include "duckdb/transaction/transaction_manager.hpp"
+
+namespace duckdb {
+
+class ExtensionLoader;
+
+//! Transaction on the read-only sudan catalog (nothing to commit or roll back)
+class SudanTransaction : public Transaction {
+public:
+	SudanTransaction(TransactionManager &manager, ClientContext &context) : Transaction(manager, context) {
+	}
+};
+
+//! Transaction manager for attached sudan catalogs
+class SudanTransactionManager : public TransactionManager {
+public:
+	explicit SudanTransactionManager(AttachedDatabase &db);
+
+	Transaction &StartTransaction(ClientContext &context) override;
+	ErrorData CommitTransaction(ClientContext &context, Transaction &transaction) override;
+	void RollbackTransaction(Transaction &transaction) override;
+	void Checkpoint(ClientContext &context, bool force = false) override;
+
+private:
+	mutex transaction_lock;
+	reference_map_t<Transaction, unique_ptr<Transaction>> transactions;
+};
+
+//! Storage extension behind `ATTACH 'sudan:' AS s (TYPE sudan)`
+class SudanStorageExtension : public StorageExtension {
+public:
+	SudanStorageExtension();
+};
+
+struct SudanStorageFunctions {
+public:
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
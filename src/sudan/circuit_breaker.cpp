@@ -0,0 +1,77 @@
+#include "circuit_breaker.hpp"
+
+namespace sudan {
+
+bool CircuitBreaker::AllowRequest(const std::string &host, uint64_t cooldown_seconds) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	switch (state.state) {
+	case State::CLOSED:
+		return true;
+	case State::OPEN: {
+		auto elapsed = std::chrono::steady_clock::now() - state.opened_at;
+		if (elapsed < std::chrono::seconds(cooldown_seconds)) {
+			return false;
+		}
+		state.state = State::HALF_OPEN;
+		state.probe_in_flight = true;
+		return true;
+	}
+	case State::HALF_OPEN:
+		// Only one probe at a time, everything else keeps failing fast until it reports back
+		if (state.probe_in_flight) {
+			return false;
+		}
+		state.probe_in_flight = true;
+		return true;
+	}
+	return true;
+}
+
+void CircuitBreaker::RecordSuccess(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	state.state = State::CLOSED;
+	state.consecutive_failures = 0;
+	state.probe_in_flight = false;
+}
+
+void CircuitBreaker::RecordFailure(const std::string &host, uint64_t threshold) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	state.consecutive_failures++;
+	if (state.state == State::HALF_OPEN || (threshold > 0 && state.consecutive_failures >= threshold)) {
+		state.state = State::OPEN;
+		state.opened_at = std::chrono::steady_clock::now();
+	}
+	state.probe_in_flight = false;
+}
+
+void CircuitBreaker::AbandonRequest(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	hosts_[host].probe_in_flight = false;
+}
+
+CircuitBreaker::State CircuitBreaker::GetState(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto entry = hosts_.find(host);
+	return entry == hosts_.end() ? State::CLOSED : entry->second.state;
+}
+
+const char *CircuitBreaker::StateName(State state) {
+	switch (state) {
+	case State::OPEN:
+		return "open";
+	case State::HALF_OPEN:
+		return "half_open";
+	default:
+		return "closed";
+	}
+}
+
+CircuitBreaker &CircuitBreaker::Instance() {
+	static CircuitBreaker instance;
+	return instance;
+}
+
+} // namespace sudan
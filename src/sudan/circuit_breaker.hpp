@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace sudan {
+
+//! Per-host circuit breaker, shared by all connections like the response cache.
+//!
+//! CLOSED: requests pass; `threshold` consecutive failures open the circuit.
+//! OPEN: requests fail fast without touching the network until `cooldown_seconds` have passed.
+//! HALF_OPEN: a single probe request passes; success closes the circuit, failure opens it again.
+class CircuitBreaker {
+public:
+	enum class State : uint8_t { CLOSED, OPEN, HALF_OPEN };
+
+	//! Whether a request to the host may be sent. Moves an expired OPEN circuit to HALF_OPEN and lets one probe pass.
+	bool AllowRequest(const std::string &host, uint64_t cooldown_seconds);
+
+	void RecordSuccess(const std::string &host);
+	void RecordFailure(const std::string &host, uint64_t threshold);
+
+	//! A request ended without telling anything about the host (e.g. the query deadline expired): let another probe
+	//! through instead of staying half-open
+	void AbandonRequest(const std::string &host);
+
+	State GetState(const std::string &host);
+
+	static const char *StateName(State state);
+
+	static CircuitBreaker &Instance();
+
+private:
+	struct HostState {
+		State state = State::CLOSED;
+		uint64_t consecutive_failures = 0;
+		std::chrono::steady_clock::time_point opened_at;
+		bool probe_in_flight = false;
+	};
+
+	std::unordered_map<std::string, HostState> hosts_;
+	std::mutex mutex_;
+};
+
+} // namespace sudan
@@ -0,0 +1,68 @@
+#include "conversion_table.hpp"
+
+#include "sudan/providers.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace sudan {
+
+ConversionTable::ConversionTable()
+    : country_count_(CountryCount()),
+      values_(SERIES_COUNT * country_count_ * YEAR_COUNT, std::numeric_limits<double>::quiet_NaN()),
+      loaded_(new std::atomic<bool>[SERIES_COUNT * country_count_]) {
+	for (size_t i = 0; i < SERIES_COUNT * country_count_; i++) {
+		loaded_[i].store(false);
+	}
+}
+
+const char *ConversionTable::IndicatorCode(Series series) {
+	switch (series) {
+	case Series::POPULATION:
+		return "SP.POP.TOTL";
+	case Series::EXCHANGE_RATE:
+		// Official exchange rate, local currency units per US$
+		return "PA.NUS.FCRF";
+	default:
+		// GDP deflator, in local currency
+		return "NY.GDP.DEFL.ZS";
+	}
+}
+
+bool ConversionTable::IsLoaded(Series series, size_t country) const {
+	return country < country_count_ && loaded_[Slot(series, country)].load(std::memory_order_acquire);
+}
+
+bool ConversionTable::Get(Series series, size_t country, int64_t year, double &value) const {
+	if (!IsLoaded(series, country) || year < FIRST_YEAR || year >= FIRST_YEAR + YEAR_COUNT) {
+		return false;
+	}
+	value = values_[Slot(series, country) * YEAR_COUNT + static_cast<size_t>(year - FIRST_YEAR)];
+	return !std::isnan(value);
+}
+
+void ConversionTable::Load(Series series, size_t country, const std::vector<std::pair<int64_t, double>> &values) {
+	if (country >= country_count_) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto slot = Slot(series, country);
+	if (loaded_[slot].load(std::memory_order_relaxed)) {
+		return;
+	}
+	auto row = values_.begin() + static_cast<std::ptrdiff_t>(slot * YEAR_COUNT);
+	for (auto &value : values) {
+		if (value.first >= FIRST_YEAR && value.first < FIRST_YEAR + YEAR_COUNT) {
+			row[value.first - FIRST_YEAR] = value.second;
+		}
+	}
+	// Publishes the values written above to lock-free readers
+	loaded_[slot].store(true, std::memory_order_release);
+}
+
+ConversionTable &ConversionTable::Instance() {
+	static ConversionTable instance;
+	return instance;
+}
+
+} // namespace sudan
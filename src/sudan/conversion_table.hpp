@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace sudan {
+
+//! Annual conversion series (population, exchange rate, GDP deflator) by country and year, shared by all connections
+//! like the response cache.
+//!
+//! Values live in one flat array indexed by (series, country, year), so a lookup is a multiplication and a load.
+//! Series are loaded per country on first use and kept for the life of the process: published history rarely
+//! changes, and every later query converts without a request.
+class ConversionTable {
+public:
+	enum class Series : uint8_t { POPULATION, EXCHANGE_RATE, DEFLATOR };
+	static constexpr size_t SERIES_COUNT = 3;
+
+	//! Years covered by the table
+	static constexpr int64_t FIRST_YEAR = 1960;
+	static constexpr int64_t YEAR_COUNT = 100;
+
+	//! World Bank indicator of a series
+	static const char *IndicatorCode(Series series);
+
+	//! Whether the series of a country (index in the ISO 3166-1 table) was loaded
+	bool IsLoaded(Series series, size_t country) const;
+
+	//! Value of a loaded series, false if the year has none
+	bool Get(Series series, size_t country, int64_t year, double &value) const;
+
+	//! Store the (year, value) observations of a series for a country and mark it loaded. Years outside the table
+	//! are dropped.
+	void Load(Series series, size_t country, const std::vector<std::pair<int64_t, double>> &values);
+
+	static ConversionTable &Instance();
+
+	ConversionTable();
+
+private:
+	size_t Slot(Series series, size_t country) const {
+		return static_cast<size_t>(series) * country_count_ + country;
+	}
+
+	size_t country_count_;
+	//! SERIES_COUNT * countries * YEAR_COUNT values, NaN where a year has none
+	std::vector<double> values_;
+	//! Per (series, country): set once its values are written, so readers need no lock
+	std::unique_ptr<std::atomic<bool>[]> loaded_;
+	std::mutex mutex_;
+};
+
+} // namespace sudan
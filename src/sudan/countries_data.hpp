@@ -0,0 +1,400 @@
+#pragma once
+
+// Auto-generated ISO 3166-1 country table with perfect hash lookup tables
+// Do not edit manually - regenerate with scripts/generate_countries.py
+
+#include "sudan/providers.hpp"
+
+namespace sudan {
+
+static constexpr uint32_t COUNTRY_HASH_BUCKETS = 64;
+static constexpr uint32_t COUNTRY_HASH_SLOTS = 512;
+static constexpr uint16_t COUNTRY_HASH_EMPTY = 0xFFFF;
+
+static constexpr CountryInfo COUNTRIES[] = {
+    {"AFG", "AF", 4, 2, 0, "Afghanistan", "\xd8\xa3\xd9\x81\xd8\xba\xd8\xa7\xd9\x86\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"ALA", "AX", 248, 0, 0, "\xc3\x85land Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa3\xd9\x88\xd9\x84\xd8\xa7\xd9\x86\xd8\xaf"},
+    {"ALB", "AL", 8, 3, 0, "Albania", "\xd8\xa3\xd9\x84\xd8\xa8\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"DZA", "DZ", 12, 4, 16, "Algeria", "\xd8\xa7\xd9\x84\xd8\xac\xd8\xb2\xd8\xa7\xd8\xa6\xd8\xb1"},
+    {"ASM", "AS", 16, 5, 0, "American Samoa", "\xd8\xb3\xd8\xa7\xd9\x85\xd9\x88\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xa3\xd9\x85\xd8\xb1\xd9\x8a\xd9\x83\xd9\x8a\xd8\xa9"},
+    {"AND", "AD", 20, 6, 0, "Andorra", "\xd8\xa3\xd9\x86\xd8\xaf\xd9\x88\xd8\xb1\xd8\xa7"},
+    {"AGO", "AO", 24, 7, 16, "Angola", "\xd8\xa3\xd9\x86\xd8\xba\xd9\x88\xd9\x84\xd8\xa7"},
+    {"AIA", "AI", 660, 258, 0, "Anguilla", "\xd8\xa3\xd9\x86\xd8\xba\xd9\x88\xd9\x8a\xd9\x84\xd8\xa7"},
+    {"ATA", "AQ", 10, 30, 0, "Antarctica", "\xd8\xa3\xd9\x86\xd8\xaa\xd8\xa7\xd8\xb1\xd9\x83\xd8\xaa\xd9\x8a\xd9\x83\xd8\xa7"},
+    {"ATG", "AG", 28, 8, 0, "Antigua and Barbuda", "\xd8\xa3\xd9\x86\xd8\xaa\xd9\x8a\xd8\xba\xd9\x88\xd8\xa7 \xd9\x88\xd8\xa8\xd8\xb1\xd8\xa8\xd9\x88\xd8\xaf\xd8\xa7"},
+    {"ARG", "AR", 32, 9, 0, "Argentina", "\xd8\xa7\xd9\x84\xd8\xa3\xd8\xb1\xd8\xac\xd9\x86\xd8\xaa\xd9\x8a\xd9\x86"},
+    {"ARM", "AM", 51, 1, 0, "Armenia", "\xd8\xa3\xd8\xb1\xd9\x85\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"ABW", "AW", 533, 22, 0, "Aruba", "\xd8\xa3\xd8\xb1\xd9\x88\xd8\xa8\xd8\xa7"},
+    {"AUS", "AU", 36, 10, 0, "Australia", "\xd8\xa3\xd8\xb3\xd8\xaa\xd8\xb1\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa7"},
+    {"AUT", "AT", 40, 11, 0, "Austria", "\xd8\xa7\xd9\x84\xd9\x86\xd9\x85\xd8\xb3\xd8\xa7"},
+    {"AZE", "AZ", 31, 52, 0, "Azerbaijan", "\xd8\xa3\xd8\xb0\xd8\xb1\xd8\xa8\xd9\x8a\xd8\xac\xd8\xa7\xd9\x86"},
+    {"BHS", "BS", 44, 12, 0, "Bahamas", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd8\xa8\xd9\x87\xd8\xa7\xd9\x85\xd8\xa7"},
+    {"BHR", "BH", 48, 13, 0, "Bahrain", "\xd8\xa7\xd9\x84\xd8\xa8\xd8\xad\xd8\xb1\xd9\x8a\xd9\x86"},
+    {"BGD", "BD", 50, 16, 0, "Bangladesh", "\xd8\xa8\xd9\x86\xd8\xba\xd9\x84\xd8\xa7\xd8\xaf\xd9\x8a\xd8\xb4"},
+    {"BRB", "BB", 52, 14, 0, "Barbados", "\xd8\xa8\xd8\xa7\xd8\xb1\xd8\xa8\xd8\xa7\xd8\xaf\xd9\x88\xd8\xb3"},
+    {"BLR", "BY", 112, 57, 0, "Belarus", "\xd8\xa8\xd9\x8a\xd9\x84\xd8\xa7\xd8\xb1\xd9\x88\xd8\xb3"},
+    {"BEL", "BE", 56, 255, 0, "Belgium", "\xd8\xa8\xd9\x84\xd8\xac\xd9\x8a\xd9\x83\xd8\xa7"},
+    {"BLZ", "BZ", 84, 23, 0, "Belize", "\xd8\xa8\xd9\x84\xd9\x8a\xd8\xb2"},
+    {"BEN", "BJ", 204, 53, 16, "Benin", "\xd8\xa8\xd9\x86\xd9\x8a\xd9\x86"},
+    {"BMU", "BM", 60, 17, 0, "Bermuda", "\xd8\xa8\xd8\xb1\xd9\x85\xd9\x88\xd8\xaf\xd8\xa7"},
+    {"BTN", "BT", 64, 18, 0, "Bhutan", "\xd8\xa8\xd9\x88\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"BOL", "BO", 68, 19, 0, "Bolivia", "\xd8\xa8\xd9\x88\xd9\x84\xd9\x8a\xd9\x81\xd9\x8a\xd8\xa7"},
+    {"BES", "BQ", 535, 278, 0, "Bonaire, Sint Eustatius and Saba", "\xd8\xa8\xd9\x88\xd9\x86\xd9\x8a\xd8\xb1 \xd9\x88\xd8\xb3\xd9\x8a\xd9\x86\xd8\xaa \xd8\xa3\xd9\x88\xd8\xb3\xd8\xaa\xd8\xa7\xd8\xaa\xd9\x8a\xd9\x88\xd8\xb3 \xd9\x88\xd8\xb3\xd8\xa7\xd8\xa8\xd8\xa7"},
+    {"BIH", "BA", 70, 80, 0, "Bosnia and Herzegovina", "\xd8\xa7\xd9\x84\xd8\xa8\xd9\x88\xd8\xb3\xd9\x86\xd8\xa9 \xd9\x88\xd8\xa7\xd9\x84\xd9\x87\xd8\xb1\xd8\xb3\xd9\x83"},
+    {"BWA", "BW", 72, 20, 16, "Botswana", "\xd8\xa8\xd9\x88\xd8\xaa\xd8\xb3\xd9\x88\xd8\xa7\xd9\x86\xd8\xa7"},
+    {"BVT", "BV", 74, 0, 0, "Bouvet Island", "\xd8\xac\xd8\xb2\xd9\x8a\xd8\xb1\xd8\xa9 \xd8\xa8\xd9\x88\xd9\x81\xd9\x8a\xd9\x87"},
+    {"BRA", "BR", 76, 21, 0, "Brazil", "\xd8\xa7\xd9\x84\xd8\xa8\xd8\xb1\xd8\xa7\xd8\xb2\xd9\x8a\xd9\x84"},
+    {"IOT", "IO", 86, 24, 0, "British Indian Ocean Territory", "\xd8\xa5\xd9\x82\xd9\x84\xd9\x8a\xd9\x85 \xd8\xa7\xd9\x84\xd9\x85\xd8\xad\xd9\x8a\xd8\xb7 \xd8\xa7\xd9\x84\xd9\x87\xd9\x86\xd8\xaf\xd9\x8a \xd8\xa7\xd9\x84\xd8\xa8\xd8\xb1\xd9\x8a\xd8\xb7\xd8\xa7\xd9\x86\xd9\x8a"},
+    {"BRN", "BN", 96, 26, 0, "Brunei Darussalam", "\xd8\xa8\xd8\xb1\xd9\x88\xd9\x86\xd8\xa7\xd9\x8a"},
+    {"BGR", "BG", 100, 27, 0, "Bulgaria", "\xd8\xa8\xd9\x84\xd8\xba\xd8\xa7\xd8\xb1\xd9\x8a\xd8\xa7"},
+    {"BFA", "BF", 854, 233, 24, "Burkina Faso", "\xd8\xa8\xd9\x88\xd8\xb1\xd9\x83\xd9\x8a\xd9\x86\xd8\xa7 \xd9\x81\xd8\xa7\xd8\xb3\xd9\x88"},
+    {"BDI", "BI", 108, 29, 20, "Burundi", "\xd8\xa8\xd9\x88\xd8\xb1\xd9\x88\xd9\x86\xd8\xaf\xd9\x8a"},
+    {"CPV", "CV", 132, 35, 16, "Cabo Verde", "\xd8\xa7\xd9\x84\xd8\xb1\xd8\xa3\xd8\xb3 \xd8\xa7\xd9\x84\xd8\xa3\xd8\xae\xd8\xb6\xd8\xb1"},
+    {"KHM", "KH", 116, 115, 0, "Cambodia", "\xd9\x83\xd9\x85\xd8\xa8\xd9\x88\xd8\xaf\xd9\x8a\xd8\xa7"},
+    {"CMR", "CM", 120, 32, 24, "Cameroon", "\xd8\xa7\xd9\x84\xd9\x83\xd8\xa7\xd9\x85\xd9\x8a\xd8\xb1\xd9\x88\xd9\x86"},
+    {"CAN", "CA", 124, 33, 0, "Canada", "\xd9\x83\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"CYM", "KY", 136, 36, 0, "Cayman Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x83\xd8\xa7\xd9\x8a\xd9\x85\xd8\xa7\xd9\x86"},
+    {"CAF", "CF", 140, 37, 17, "Central African Republic", "\xd8\xac\xd9\x85\xd9\x87\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9 \xd8\xa3\xd9\x81\xd8\xb1\xd9\x8a\xd9\x82\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd9\x88\xd8\xb3\xd8\xb7\xd9\x89"},
+    {"TCD", "TD", 148, 39, 25, "Chad", "\xd8\xaa\xd8\xb4\xd8\xa7\xd8\xaf"},
+    {"CHL", "CL", 152, 40, 0, "Chile", "\xd8\xaa\xd8\xb4\xd9\x8a\xd9\x84\xd9\x8a"},
+    {"CHN", "CN", 156, 41, 0, "China", "\xd8\xa7\xd9\x84\xd8\xb5\xd9\x8a\xd9\x86"},
+    {"CXR", "CX", 162, 42, 0, "Christmas Island", "\xd8\xac\xd8\xb2\xd9\x8a\xd8\xb1\xd8\xa9 \xd9\x83\xd8\xb1\xd9\x8a\xd8\xb3\xd9\x85\xd8\xa7\xd8\xb3"},
+    {"CCK", "CC", 166, 43, 0, "Cocos (Keeling) Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x83\xd9\x88\xd9\x83\xd9\x88\xd8\xb3"},
+    {"COL", "CO", 170, 44, 0, "Colombia", "\xd9\x83\xd9\x88\xd9\x84\xd9\x88\xd9\x85\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"COM", "KM", 174, 45, 16, "Comoros", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd9\x82\xd9\x85\xd8\xb1"},
+    {"COG", "CG", 178, 46, 16, "Congo", "\xd8\xa7\xd9\x84\xd9\x83\xd9\x88\xd9\x86\xd8\xba\xd9\x88"},
+    {"COD", "CD", 180, 250, 20, "Democratic Republic of the Congo", "\xd8\xac\xd9\x85\xd9\x87\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9 \xd8\xa7\xd9\x84\xd9\x83\xd9\x88\xd9\x86\xd8\xba\xd9\x88 \xd8\xa7\xd9\x84\xd8\xaf\xd9\x8a\xd9\x85\xd9\x82\xd8\xb1\xd8\xa7\xd8\xb7\xd9\x8a\xd8\xa9"},
+    {"COK", "CK", 184, 47, 0, "Cook Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x83\xd9\x88\xd9\x83"},
+    {"CRI", "CR", 188, 48, 0, "Costa Rica", "\xd9\x83\xd9\x88\xd8\xb3\xd8\xaa\xd8\xa7\xd8\xb1\xd9\x8a\xd9\x83\xd8\xa7"},
+    {"CIV", "CI", 384, 107, 16, "C\xc3\xb4te d'Ivoire", "\xd8\xb3\xd8\xa7\xd8\xad\xd9\x84 \xd8\xa7\xd9\x84\xd8\xb9\xd8\xa7\xd8\xac"},
+    {"HRV", "HR", 191, 98, 0, "Croatia", "\xd9\x83\xd8\xb1\xd9\x88\xd8\xa7\xd8\xaa\xd9\x8a\xd8\xa7"},
+    {"CUB", "CU", 192, 49, 0, "Cuba", "\xd9\x83\xd9\x88\xd8\xa8\xd8\xa7"},
+    {"CUW", "CW", 531, 279, 0, "Cura\xc3\xa7" "ao", "\xd9\x83\xd9\x88\xd8\xb1\xd8\xa7\xd8\xb3\xd8\xa7\xd9\x88"},
+    {"CYP", "CY", 196, 50, 0, "Cyprus", "\xd9\x82\xd8\xa8\xd8\xb1\xd8\xb5"},
+    {"CZE", "CZ", 203, 167, 0, "Czechia", "\xd8\xa7\xd9\x84\xd8\xaa\xd8\xb4\xd9\x8a\xd9\x83"},
+    {"DNK", "DK", 208, 54, 0, "Denmark", "\xd8\xa7\xd9\x84\xd8\xaf\xd9\x86\xd9\x85\xd8\xa7\xd8\xb1\xd9\x83"},
+    {"DJI", "DJ", 262, 72, 18, "Djibouti", "\xd8\xac\xd9\x8a\xd8\xa8\xd9\x88\xd8\xaa\xd9\x8a"},
+    {"DMA", "DM", 212, 55, 0, "Dominica", "\xd8\xaf\xd9\x88\xd9\x85\xd9\x8a\xd9\x86\xd9\x8a\xd9\x83\xd8\xa7"},
+    {"DOM", "DO", 214, 56, 0, "Dominican Republic", "\xd8\xac\xd9\x85\xd9\x87\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9 \xd8\xa7\xd9\x84\xd8\xaf\xd9\x88\xd9\x85\xd9\x8a\xd9\x86\xd9\x8a\xd9\x83\xd8\xa7\xd9\x86"},
+    {"ECU", "EC", 218, 58, 0, "Ecuador", "\xd8\xa7\xd9\x84\xd8\xa5\xd9\x83\xd9\x88\xd8\xa7\xd8\xaf\xd9\x88\xd8\xb1"},
+    {"EGY", "EG", 818, 59, 21, "Egypt", "\xd9\x85\xd8\xb5\xd8\xb1"},
+    {"SLV", "SV", 222, 60, 0, "El Salvador", "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x84\xd9\x81\xd8\xa7\xd8\xaf\xd9\x88\xd8\xb1"},
+    {"GNQ", "GQ", 226, 61, 16, "Equatorial Guinea", "\xd8\xba\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xa7\xd8\xb3\xd8\xaa\xd9\x88\xd8\xa7\xd8\xa6\xd9\x8a\xd8\xa9"},
+    {"ERI", "ER", 232, 178, 23, "Eritrea", "\xd8\xa5\xd8\xb1\xd9\x8a\xd8\xaa\xd8\xb1\xd9\x8a\xd8\xa7"},
+    {"EST", "EE", 233, 63, 0, "Estonia", "\xd8\xa5\xd8\xb3\xd8\xaa\xd9\x88\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"SWZ", "SZ", 748, 209, 16, "Eswatini", "\xd8\xa5\xd8\xb3\xd9\x88\xd8\xa7\xd8\xaa\xd9\x8a\xd9\x86\xd9\x8a"},
+    {"ETH", "ET", 231, 238, 23, "Ethiopia", "\xd8\xa5\xd8\xab\xd9\x8a\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"FLK", "FK", 238, 65, 0, "Falkland Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x81\xd9\x88\xd9\x83\xd9\x84\xd8\xa7\xd9\x86\xd8\xaf"},
+    {"FRO", "FO", 234, 64, 0, "Faroe Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x81\xd8\xa7\xd8\xb1\xd9\x88"},
+    {"FJI", "FJ", 242, 66, 0, "Fiji", "\xd9\x81\xd9\x8a\xd8\xac\xd9\x8a"},
+    {"FIN", "FI", 246, 67, 0, "Finland", "\xd9\x81\xd9\x86\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"FRA", "FR", 250, 68, 0, "France", "\xd9\x81\xd8\xb1\xd9\x86\xd8\xb3\xd8\xa7"},
+    {"GUF", "GF", 254, 69, 0, "French Guiana", "\xd8\xba\xd9\x88\xd9\x8a\xd8\xa7\xd9\x86\xd8\xa7 \xd8\xa7\xd9\x84\xd9\x81\xd8\xb1\xd9\x86\xd8\xb3\xd9\x8a\xd8\xa9"},
+    {"PYF", "PF", 258, 70, 0, "French Polynesia", "\xd8\xa8\xd9\x88\xd9\x84\xd9\x8a\xd9\x86\xd9\x8a\xd8\xb2\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd9\x81\xd8\xb1\xd9\x86\xd8\xb3\xd9\x8a\xd8\xa9"},
+    {"ATF", "TF", 260, 0, 0, "French Southern Territories", "\xd8\xa7\xd9\x84\xd8\xa3\xd9\x82\xd8\xa7\xd9\x84\xd9\x8a\xd9\x85 \xd8\xa7\xd9\x84\xd8\xac\xd9\x86\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa9 \xd8\xa7\xd9\x84\xd9\x81\xd8\xb1\xd9\x86\xd8\xb3\xd9\x8a\xd8\xa9"},
+    {"GAB", "GA", 266, 74, 16, "Gabon", "\xd8\xa7\xd9\x84\xd8\xba\xd8\xa7\xd8\xa8\xd9\x88\xd9\x86"},
+    {"GMB", "GM", 270, 75, 24, "Gambia", "\xd8\xba\xd8\xa7\xd9\x85\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"GEO", "GE", 268, 73, 0, "Georgia", "\xd8\xac\xd9\x88\xd8\xb1\xd8\xac\xd9\x8a\xd8\xa7"},
+    {"DEU", "DE", 276, 79, 0, "Germany", "\xd8\xa3\xd9\x84\xd9\x85\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"GHA", "GH", 288, 81, 16, "Ghana", "\xd8\xba\xd8\xa7\xd9\x86\xd8\xa7"},
+    {"GIB", "GI", 292, 82, 0, "Gibraltar", "\xd8\xac\xd8\xa8\xd9\x84 \xd8\xb7\xd8\xa7\xd8\xb1\xd9\x82"},
+    {"GRC", "GR", 300, 84, 0, "Greece", "\xd8\xa7\xd9\x84\xd9\x8a\xd9\x88\xd9\x86\xd8\xa7\xd9\x86"},
+    {"GRL", "GL", 304, 85, 0, "Greenland", "\xd8\xba\xd8\xb1\xd9\x8a\xd9\x86\xd9\x84\xd8\xa7\xd9\x86\xd8\xaf"},
+    {"GRD", "GD", 308, 86, 0, "Grenada", "\xd8\xba\xd8\xb1\xd9\x8a\xd9\x86\xd8\xa7\xd8\xaf\xd8\xa7"},
+    {"GLP", "GP", 312, 87, 0, "Guadeloupe", "\xd8\xba\xd9\x88\xd8\xa7\xd8\xaf\xd9\x84\xd9\x88\xd8\xa8"},
+    {"GUM", "GU", 316, 88, 0, "Guam", "\xd8\xba\xd9\x88\xd8\xa7\xd9\x85"},
+    {"GTM", "GT", 320, 89, 0, "Guatemala", "\xd8\xba\xd9\x88\xd8\xa7\xd8\xaa\xd9\x8a\xd9\x85\xd8\xa7\xd9\x84\xd8\xa7"},
+    {"GGY", "GG", 831, 0, 0, "Guernsey", "\xd8\xba\xd9\x8a\xd8\xb1\xd9\x86\xd8\xb2\xd9\x8a"},
+    {"GIN", "GN", 324, 90, 24, "Guinea", "\xd8\xba\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"GNB", "GW", 624, 175, 16, "Guinea-Bissau", "\xd8\xba\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7 \xd8\xa8\xd9\x8a\xd8\xb3\xd8\xa7\xd9\x88"},
+    {"GUY", "GY", 328, 91, 0, "Guyana", "\xd8\xba\xd9\x8a\xd8\xa7\xd9\x86\xd8\xa7"},
+    {"HTI", "HT", 332, 93, 0, "Haiti", "\xd9\x87\xd8\xa7\xd9\x8a\xd8\xaa\xd9\x8a"},
+    {"HMD", "HM", 334, 0, 0, "Heard Island and McDonald Islands", "\xd8\xac\xd8\xb2\xd9\x8a\xd8\xb1\xd8\xa9 \xd9\x87\xd9\x8a\xd8\xb1\xd8\xaf \xd9\x88\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x85\xd8\xa7\xd9\x83\xd8\xaf\xd9\x88\xd9\x86\xd8\xa7\xd9\x84\xd8\xaf"},
+    {"VAT", "VA", 336, 94, 0, "Holy See", "\xd8\xa7\xd9\x84\xd9\x81\xd8\xa7\xd8\xaa\xd9\x8a\xd9\x83\xd8\xa7\xd9\x86"},
+    {"HND", "HN", 340, 95, 0, "Honduras", "\xd9\x87\xd9\x86\xd8\xaf\xd9\x88\xd8\xb1\xd8\xa7\xd8\xb3"},
+    {"HKG", "HK", 344, 96, 0, "Hong Kong", "\xd9\x87\xd9\x88\xd9\x86\xd8\xba \xd9\x83\xd9\x88\xd9\x86\xd8\xba"},
+    {"HUN", "HU", 348, 97, 0, "Hungary", "\xd8\xa7\xd9\x84\xd9\x85\xd8\xac\xd8\xb1"},
+    {"ISL", "IS", 352, 99, 0, "Iceland", "\xd8\xa2\xd9\x8a\xd8\xb3\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"IND", "IN", 356, 100, 0, "India", "\xd8\xa7\xd9\x84\xd9\x87\xd9\x86\xd8\xaf"},
+    {"IDN", "ID", 360, 101, 0, "Indonesia", "\xd8\xa5\xd9\x86\xd8\xaf\xd9\x88\xd9\x86\xd9\x8a\xd8\xb3\xd9\x8a\xd8\xa7"},
+    {"IRN", "IR", 364, 102, 0, "Iran", "\xd8\xa5\xd9\x8a\xd8\xb1\xd8\xa7\xd9\x86"},
+    {"IRQ", "IQ", 368, 103, 0, "Iraq", "\xd8\xa7\xd9\x84\xd8\xb9\xd8\xb1\xd8\xa7\xd9\x82"},
+    {"IRL", "IE", 372, 104, 0, "Ireland", "\xd8\xa3\xd9\x8a\xd8\xb1\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"IMN", "IM", 833, 264, 0, "Isle of Man", "\xd8\xac\xd8\xb2\xd9\x8a\xd8\xb1\xd8\xa9 \xd9\x85\xd8\xa7\xd9\x86"},
+    {"ISR", "IL", 376, 105, 0, "Israel", "\xd8\xa5\xd8\xb3\xd8\xb1\xd8\xa7\xd8\xa6\xd9\x8a\xd9\x84"},
+    {"ITA", "IT", 380, 106, 0, "Italy", "\xd8\xa5\xd9\x8a\xd8\xb7\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa7"},
+    {"JAM", "JM", 388, 109, 0, "Jamaica", "\xd8\xac\xd8\xa7\xd9\x85\xd8\xa7\xd9\x8a\xd9\x83\xd8\xa7"},
+    {"JPN", "JP", 392, 110, 0, "Japan", "\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa7\xd8\xa8\xd8\xa7\xd9\x86"},
+    {"JEY", "JE", 832, 0, 0, "Jersey", "\xd8\xac\xd9\x8a\xd8\xb1\xd8\xb2\xd9\x8a"},
+    {"JOR", "JO", 400, 112, 0, "Jordan", "\xd8\xa7\xd9\x84\xd8\xa3\xd8\xb1\xd8\xaf\xd9\x86"},
+    {"KAZ", "KZ", 398, 108, 0, "Kazakhstan", "\xd9\x83\xd8\xa7\xd8\xb2\xd8\xa7\xd8\xae\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"KEN", "KE", 404, 114, 22, "Kenya", "\xd9\x83\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"KIR", "KI", 296, 83, 0, "Kiribati", "\xd9\x83\xd9\x8a\xd8\xb1\xd9\x8a\xd8\xa8\xd8\xa7\xd8\xaa\xd9\x8a"},
+    {"PRK", "KP", 408, 116, 0, "North Korea", "\xd9\x83\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xb4\xd9\x85\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa9"},
+    {"KOR", "KR", 410, 117, 0, "South Korea", "\xd9\x83\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xac\xd9\x86\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa9"},
+    {"KWT", "KW", 414, 118, 0, "Kuwait", "\xd8\xa7\xd9\x84\xd9\x83\xd9\x88\xd9\x8a\xd8\xaa"},
+    {"KGZ", "KG", 417, 113, 0, "Kyrgyzstan", "\xd9\x82\xd9\x8a\xd8\xb1\xd8\xba\xd9\x8a\xd8\xb2\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"LAO", "LA", 418, 120, 0, "Lao People's Democratic Republic", "\xd9\x84\xd8\xa7\xd9\x88\xd8\xb3"},
+    {"LVA", "LV", 428, 119, 0, "Latvia", "\xd9\x84\xd8\xa7\xd8\xaa\xd9\x81\xd9\x8a\xd8\xa7"},
+    {"LBN", "LB", 422, 121, 0, "Lebanon", "\xd9\x84\xd8\xa8\xd9\x86\xd8\xa7\xd9\x86"},
+    {"LSO", "LS", 426, 122, 16, "Lesotho", "\xd9\x84\xd9\x8a\xd8\xb3\xd9\x88\xd8\xaa\xd9\x88"},
+    {"LBR", "LR", 430, 123, 16, "Liberia", "\xd9\x84\xd9\x8a\xd8\xa8\xd9\x8a\xd8\xb1\xd9\x8a\xd8\xa7"},
+    {"LBY", "LY", 434, 124, 17, "Libya", "\xd9\x84\xd9\x8a\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"LIE", "LI", 438, 125, 0, "Liechtenstein", "\xd9\x84\xd9\x8a\xd8\xae\xd8\xaa\xd9\x86\xd8\xb4\xd8\xaa\xd8\xa7\xd9\x8a\xd9\x86"},
+    {"LTU", "LT", 440, 126, 0, "Lithuania", "\xd9\x84\xd9\x8a\xd8\xaa\xd9\x88\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"LUX", "LU", 442, 256, 0, "Luxembourg", "\xd9\x84\xd9\x88\xd9\x83\xd8\xb3\xd9\x85\xd8\xa8\xd9\x88\xd8\xb1\xd8\xba"},
+    {"MAC", "MO", 446, 128, 0, "Macao", "\xd9\x85\xd8\xa7\xd9\x83\xd8\xa7\xd9\x88"},
+    {"MDG", "MG", 450, 129, 16, "Madagascar", "\xd9\x85\xd8\xaf\xd8\xba\xd8\xb4\xd9\x82\xd8\xb1"},
+    {"MWI", "MW", 454, 130, 16, "Malawi", "\xd9\x85\xd8\xa7\xd9\x84\xd8\xa7\xd9\x88\xd9\x8a"},
+    {"MYS", "MY", 458, 131, 0, "Malaysia", "\xd9\x85\xd8\xa7\xd9\x84\xd9\x8a\xd8\xb2\xd9\x8a\xd8\xa7"},
+    {"MDV", "MV", 462, 132, 0, "Maldives", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd9\x85\xd8\xa7\xd9\x84\xd8\xaf\xd9\x8a\xd9\x81"},
+    {"MLI", "ML", 466, 133, 24, "Mali", "\xd9\x85\xd8\xa7\xd9\x84\xd9\x8a"},
+    {"MLT", "MT", 470, 134, 0, "Malta", "\xd9\x85\xd8\xa7\xd9\x84\xd8\xb7\xd8\xa7"},
+    {"MHL", "MH", 584, 127, 0, "Marshall Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x85\xd8\xa7\xd8\xb1\xd8\xb4\xd8\xa7\xd9\x84"},
+    {"MTQ", "MQ", 474, 135, 0, "Martinique", "\xd9\x85\xd8\xa7\xd8\xb1\xd8\xaa\xd9\x8a\xd9\x86\xd9\x8a\xd9\x83"},
+    {"MRT", "MR", 478, 136, 24, "Mauritania", "\xd9\x85\xd9\x88\xd8\xb1\xd9\x8a\xd8\xaa\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"MUS", "MU", 480, 137, 16, "Mauritius", "\xd9\x85\xd9\x88\xd8\xb1\xd9\x8a\xd8\xb4\xd9\x8a\xd9\x88\xd8\xb3"},
+    {"MYT", "YT", 175, 270, 0, "Mayotte", "\xd9\x85\xd8\xa7\xd9\x8a\xd9\x88\xd8\xaa"},
+    {"MEX", "MX", 484, 138, 0, "Mexico", "\xd8\xa7\xd9\x84\xd9\x85\xd9\x83\xd8\xb3\xd9\x8a\xd9\x83"},
+    {"FSM", "FM", 583, 145, 0, "Micronesia", "\xd9\x85\xd9\x8a\xd9\x83\xd8\xb1\xd9\x88\xd9\x86\xd9\x8a\xd8\xb2\xd9\x8a\xd8\xa7"},
+    {"MDA", "MD", 498, 146, 0, "Moldova", "\xd9\x85\xd9\x88\xd9\x84\xd8\xaf\xd9\x88\xd9\x81\xd8\xa7"},
+    {"MCO", "MC", 492, 140, 0, "Monaco", "\xd9\x85\xd9\x88\xd9\x86\xd8\xa7\xd9\x83\xd9\x88"},
+    {"MNG", "MN", 496, 141, 0, "Mongolia", "\xd9\x85\xd9\x86\xd8\xba\xd9\x88\xd9\x84\xd9\x8a\xd8\xa7"},
+    {"MNE", "ME", 499, 273, 0, "Montenegro", "\xd8\xa7\xd9\x84\xd8\xac\xd8\xa8\xd9\x84 \xd8\xa7\xd9\x84\xd8\xa3\xd8\xb3\xd9\x88\xd8\xaf"},
+    {"MSR", "MS", 500, 142, 0, "Montserrat", "\xd9\x85\xd9\x88\xd9\x86\xd8\xaa\xd8\xb3\xd8\xb1\xd8\xa7\xd8\xaa"},
+    {"MAR", "MA", 504, 143, 16, "Morocco", "\xd8\xa7\xd9\x84\xd9\x85\xd8\xba\xd8\xb1\xd8\xa8"},
+    {"MOZ", "MZ", 508, 144, 16, "Mozambique", "\xd9\x85\xd9\x88\xd8\xb2\xd9\x85\xd8\xa8\xd9\x8a\xd9\x82"},
+    {"MMR", "MM", 104, 28, 0, "Myanmar", "\xd9\x85\xd9\x8a\xd8\xa7\xd9\x86\xd9\x85\xd8\xa7\xd8\xb1"},
+    {"NAM", "NA", 516, 147, 16, "Namibia", "\xd9\x86\xd8\xa7\xd9\x85\xd9\x8a\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"NRU", "NR", 520, 148, 0, "Nauru", "\xd9\x86\xd8\xa7\xd9\x88\xd8\xb1\xd9\x88"},
+    {"NPL", "NP", 524, 149, 0, "Nepal", "\xd9\x86\xd9\x8a\xd8\xa8\xd8\xa7\xd9\x84"},
+    {"NLD", "NL", 528, 150, 0, "Netherlands", "\xd9\x87\xd9\x88\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"NCL", "NC", 540, 153, 0, "New Caledonia", "\xd9\x83\xd8\xa7\xd9\x84\xd9\x8a\xd8\xaf\xd9\x88\xd9\x86\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xac\xd8\xaf\xd9\x8a\xd8\xaf\xd8\xa9"},
+    {"NZL", "NZ", 554, 156, 0, "New Zealand", "\xd9\x86\xd9\x8a\xd9\x88\xd8\xb2\xd9\x8a\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"NIC", "NI", 558, 157, 0, "Nicaragua", "\xd9\x86\xd9\x8a\xd9\x83\xd8\xa7\xd8\xb1\xd8\xa7\xd8\xba\xd9\x88\xd8\xa7"},
+    {"NER", "NE", 562, 158, 24, "Niger", "\xd8\xa7\xd9\x84\xd9\x86\xd9\x8a\xd8\xac\xd8\xb1"},
+    {"NGA", "NG", 566, 159, 24, "Nigeria", "\xd9\x86\xd9\x8a\xd8\xac\xd9\x8a\xd8\xb1\xd9\x8a\xd8\xa7"},
+    {"NIU", "NU", 570, 160, 0, "Niue", "\xd9\x86\xd9\x8a\xd9\x88\xd9\x8a"},
+    {"NFK", "NF", 574, 161, 0, "Norfolk Island", "\xd8\xac\xd8\xb2\xd9\x8a\xd8\xb1\xd8\xa9 \xd9\x86\xd9\x88\xd8\xb1\xd9\x81\xd9\x88\xd9\x84\xd9\x83"},
+    {"MKD", "MK", 807, 154, 0, "North Macedonia", "\xd9\x85\xd9\x82\xd8\xaf\xd9\x88\xd9\x86\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xb4\xd9\x85\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa9"},
+    {"MNP", "MP", 580, 163, 0, "Northern Mariana Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd9\x85\xd8\xa7\xd8\xb1\xd9\x8a\xd8\xa7\xd9\x86\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xb4\xd9\x85\xd8\xa7\xd9\x84\xd9\x8a\xd8\xa9"},
+    {"NOR", "NO", 578, 162, 0, "Norway", "\xd8\xa7\xd9\x84\xd9\x86\xd8\xb1\xd9\x88\xd9\x8a\xd8\xac"},
+    {"OMN", "OM", 512, 221, 0, "Oman", "\xd8\xb9\xd9\x85\xd8\xa7\xd9\x86"},
+    {"PAK", "PK", 586, 165, 0, "Pakistan", "\xd8\xa8\xd8\xa7\xd9\x83\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"PLW", "PW", 585, 180, 0, "Palau", "\xd8\xa8\xd8\xa7\xd9\x84\xd8\xa7\xd9\x88"},
+    {"PSE", "PS", 275, 299, 0, "Palestine", "\xd9\x81\xd9\x84\xd8\xb3\xd8\xb7\xd9\x8a\xd9\x86"},
+    {"PAN", "PA", 591, 166, 0, "Panama", "\xd8\xa8\xd9\x86\xd9\x85\xd8\xa7"},
+    {"PNG", "PG", 598, 168, 0, "Papua New Guinea", "\xd8\xa8\xd8\xa7\xd8\xa8\xd9\x88\xd8\xa7 \xd8\xba\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xac\xd8\xaf\xd9\x8a\xd8\xaf\xd8\xa9"},
+    {"PRY", "PY", 600, 169, 0, "Paraguay", "\xd8\xa8\xd8\xa7\xd8\xb1\xd8\xa7\xd8\xba\xd9\x88\xd8\xa7\xd9\x8a"},
+    {"PER", "PE", 604, 170, 0, "Peru", "\xd8\xa8\xd9\x8a\xd8\xb1\xd9\x88"},
+    {"PHL", "PH", 608, 171, 0, "Philippines", "\xd8\xa7\xd9\x84\xd9\x81\xd9\x84\xd8\xa8\xd9\x8a\xd9\x86"},
+    {"PCN", "PN", 612, 172, 0, "Pitcairn", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa8\xd9\x8a\xd8\xaa\xd9\x83\xd9\x8a\xd8\xb1\xd9\x86"},
+    {"POL", "PL", 616, 173, 0, "Poland", "\xd8\xa8\xd9\x88\xd9\x84\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"PRT", "PT", 620, 174, 0, "Portugal", "\xd8\xa7\xd9\x84\xd8\xa8\xd8\xb1\xd8\xaa\xd8\xba\xd8\xa7\xd9\x84"},
+    {"PRI", "PR", 630, 177, 0, "Puerto Rico", "\xd8\xa8\xd9\x88\xd8\xb1\xd8\xaa\xd9\x88\xd8\xb1\xd9\x8a\xd9\x83\xd9\x88"},
+    {"QAT", "QA", 634, 179, 0, "Qatar", "\xd9\x82\xd8\xb7\xd8\xb1"},
+    {"REU", "RE", 638, 182, 0, "R\xc3\xa9union", "\xd8\xb1\xd9\x8a\xd9\x88\xd9\x86\xd9\x8a\xd9\x88\xd9\x86"},
+    {"ROU", "RO", 642, 183, 0, "Romania", "\xd8\xb1\xd9\x88\xd9\x85\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"RUS", "RU", 643, 185, 0, "Russian Federation", "\xd8\xb1\xd9\x88\xd8\xb3\xd9\x8a\xd8\xa7"},
+    {"RWA", "RW", 646, 184, 20, "Rwanda", "\xd8\xb1\xd9\x88\xd8\xa7\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"BLM", "BL", 652, 282, 0, "Saint Barth\xc3\xa9lemy", "\xd8\xb3\xd8\xa7\xd9\x86 \xd8\xa8\xd8\xa7\xd8\xb1\xd8\xaa\xd9\x8a\xd9\x84\xd9\x85\xd9\x8a"},
+    {"SHN", "SH", 654, 187, 0, "Saint Helena, Ascension and Tristan da Cunha", "\xd8\xb3\xd8\xa7\xd9\x86\xd8\xaa \xd9\x87\xd9\x8a\xd9\x84\xd9\x8a\xd9\x86\xd8\xa7"},
+    {"KNA", "KN", 659, 188, 0, "Saint Kitts and Nevis", "\xd8\xb3\xd8\xa7\xd9\x86\xd8\xaa \xd9\x83\xd9\x8a\xd8\xaa\xd8\xb3 \xd9\x88\xd9\x86\xd9\x8a\xd9\x81\xd9\x8a\xd8\xb3"},
+    {"LCA", "LC", 662, 189, 0, "Saint Lucia", "\xd8\xb3\xd8\xa7\xd9\x86\xd8\xaa \xd9\x84\xd9\x88\xd8\xb3\xd9\x8a\xd8\xa7"},
+    {"MAF", "MF", 663, 283, 0, "Saint Martin (French part)", "\xd8\xb3\xd8\xa7\xd9\x86 \xd9\x85\xd8\xa7\xd8\xb1\xd8\xaa\xd9\x86"},
+    {"SPM", "PM", 666, 190, 0, "Saint Pierre and Miquelon", "\xd8\xb3\xd8\xa7\xd9\x86 \xd8\xa8\xd9\x8a\xd9\x8a\xd8\xb1 \xd9\x88\xd9\x85\xd9\x8a\xd9\x83\xd9\x84\xd9\x88\xd9\x86"},
+    {"VCT", "VC", 670, 191, 0, "Saint Vincent and the Grenadines", "\xd8\xb3\xd8\xa7\xd9\x86\xd8\xaa \xd9\x81\xd9\x86\xd8\xb3\xd9\x86\xd8\xaa \xd9\x88\xd8\xa7\xd9\x84\xd8\xba\xd8\xb1\xd9\x8a\xd9\x86\xd8\xa7\xd8\xaf\xd9\x8a\xd9\x86"},
+    {"WSM", "WS", 882, 244, 0, "Samoa", "\xd8\xb3\xd8\xa7\xd9\x85\xd9\x88\xd8\xa7"},
+    {"SMR", "SM", 674, 192, 0, "San Marino", "\xd8\xb3\xd8\xa7\xd9\x86 \xd9\x85\xd8\xa7\xd8\xb1\xd9\x8a\xd9\x86\xd9\x88"},
+    {"STP", "ST", 678, 193, 16, "Sao Tome and Principe", "\xd8\xb3\xd8\xa7\xd9\x88 \xd8\xaa\xd9\x88\xd9\x85\xd9\x8a \xd9\x88\xd8\xa8\xd8\xb1\xd9\x8a\xd9\x86\xd8\xb3\xd9\x8a\xd8\xa8"},
+    {"SAU", "SA", 682, 194, 0, "Saudi Arabia", "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xd9\x8a\xd8\xa9"},
+    {"SEN", "SN", 686, 195, 24, "Senegal", "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x86\xd8\xba\xd8\xa7\xd9\x84"},
+    {"SRB", "RS", 688, 272, 0, "Serbia", "\xd8\xb5\xd8\xb1\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"SYC", "SC", 690, 196, 16, "Seychelles", "\xd8\xb3\xd9\x8a\xd8\xb4\xd9\x84"},
+    {"SLE", "SL", 694, 197, 16, "Sierra Leone", "\xd8\xb3\xd9\x8a\xd8\xb1\xd8\xa7\xd9\x84\xd9\x8a\xd9\x88\xd9\x86"},
+    {"SGP", "SG", 702, 200, 0, "Singapore", "\xd8\xb3\xd9\x86\xd8\xba\xd8\xa7\xd9\x81\xd9\x88\xd8\xb1\xd8\xa9"},
+    {"SXM", "SX", 534, 281, 0, "Sint Maarten (Dutch part)", "\xd8\xb3\xd9\x8a\xd9\x86\xd8\xaa \xd9\x85\xd8\xa7\xd8\xb1\xd8\xaa\xd9\x86"},
+    {"SVK", "SK", 703, 199, 0, "Slovakia", "\xd8\xb3\xd9\x84\xd9\x88\xd9\x81\xd8\xa7\xd9\x83\xd9\x8a\xd8\xa7"},
+    {"SVN", "SI", 705, 198, 0, "Slovenia", "\xd8\xb3\xd9\x84\xd9\x88\xd9\x81\xd9\x8a\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"SLB", "SB", 90, 25, 0, "Solomon Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xb3\xd9\x84\xd9\x8a\xd9\x85\xd8\xa7\xd9\x86"},
+    {"SOM", "SO", 706, 201, 18, "Somalia", "\xd8\xa7\xd9\x84\xd8\xb5\xd9\x88\xd9\x85\xd8\xa7\xd9\x84"},
+    {"ZAF", "ZA", 710, 202, 16, "South Africa", "\xd8\xac\xd9\x86\xd9\x88\xd8\xa8 \xd8\xa3\xd9\x81\xd8\xb1\xd9\x8a\xd9\x82\xd9\x8a\xd8\xa7"},
+    {"SGS", "GS", 239, 0, 0, "South Georgia and the South Sandwich Islands", "\xd8\xac\xd9\x88\xd8\xb1\xd8\xac\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd8\xac\xd9\x86\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa9 \xd9\x88\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xb3\xd8\xa7\xd9\x86\xd8\xaf\xd9\x88\xd9\x8a\xd8\xaa\xd8\xb4 \xd8\xa7\xd9\x84\xd8\xac\xd9\x86\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa9"},
+    {"SSD", "SS", 728, 277, 23, "South Sudan", "\xd8\xac\xd9\x86\xd9\x88\xd8\xa8 \xd8\xa7\xd9\x84\xd8\xb3\xd9\x88\xd8\xaf\xd8\xa7\xd9\x86"},
+    {"ESP", "ES", 724, 203, 0, "Spain", "\xd8\xa5\xd8\xb3\xd8\xa8\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"LKA", "LK", 144, 38, 0, "Sri Lanka", "\xd8\xb3\xd8\xb1\xd9\x8a\xd9\x84\xd8\xa7\xd9\x86\xd9\x83\xd8\xa7"},
+    {"SDN", "SD", 729, 276, 22, "Sudan", "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x88\xd8\xaf\xd8\xa7\xd9\x86"},
+    {"SUR", "SR", 740, 207, 0, "Suriname", "\xd8\xb3\xd9\x88\xd8\xb1\xd9\x8a\xd9\x86\xd8\xa7\xd9\x85"},
+    {"SJM", "SJ", 744, 260, 0, "Svalbard and Jan Mayen", "\xd8\xb3\xd9\x81\xd8\xa7\xd9\x84\xd8\xa8\xd8\xa7\xd8\xb1\xd8\xaf \xd9\x88\xd9\x8a\xd8\xa7\xd9\x86 \xd9\x85\xd8\xa7\xd9\x8a\xd9\x86"},
+    {"SWE", "SE", 752, 210, 0, "Sweden", "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x88\xd9\x8a\xd8\xaf"},
+    {"CHE", "CH", 756, 211, 0, "Switzerland", "\xd8\xb3\xd9\x88\xd9\x8a\xd8\xb3\xd8\xb1\xd8\xa7"},
+    {"SYR", "SY", 760, 212, 0, "Syrian Arab Republic", "\xd8\xb3\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa7"},
+    {"TWN", "TW", 158, 214, 0, "Taiwan", "\xd8\xaa\xd8\xa7\xd9\x8a\xd9\x88\xd8\xa7\xd9\x86"},
+    {"TJK", "TJ", 762, 208, 0, "Tajikistan", "\xd8\xb7\xd8\xa7\xd8\xac\xd9\x8a\xd9\x83\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"TZA", "TZ", 834, 215, 20, "Tanzania", "\xd8\xaa\xd9\x86\xd8\xb2\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"THA", "TH", 764, 216, 0, "Thailand", "\xd8\xaa\xd8\xa7\xd9\x8a\xd9\x84\xd8\xa7\xd9\x86\xd8\xaf"},
+    {"TLS", "TL", 626, 176, 0, "Timor-Leste", "\xd8\xaa\xd9\x8a\xd9\x85\xd9\x88\xd8\xb1 \xd8\xa7\xd9\x84\xd8\xb4\xd8\xb1\xd9\x82\xd9\x8a\xd8\xa9"},
+    {"TGO", "TG", 768, 217, 16, "Togo", "\xd8\xaa\xd9\x88\xd8\xba\xd9\x88"},
+    {"TKL", "TK", 772, 218, 0, "Tokelau", "\xd8\xaa\xd9\x88\xd9\x83\xd9\x8a\xd9\x84\xd8\xa7\xd9\x88"},
+    {"TON", "TO", 776, 219, 0, "Tonga", "\xd8\xaa\xd9\x88\xd9\x86\xd8\xba\xd8\xa7"},
+    {"TTO", "TT", 780, 220, 0, "Trinidad and Tobago", "\xd8\xaa\xd8\xb1\xd9\x8a\xd9\x86\xd9\x8a\xd8\xaf\xd8\xa7\xd8\xaf \xd9\x88\xd8\xaa\xd9\x88\xd8\xa8\xd8\xa7\xd8\xba\xd9\x88"},
+    {"TUN", "TN", 788, 222, 16, "Tunisia", "\xd8\xaa\xd9\x88\xd9\x86\xd8\xb3"},
+    {"TUR", "TR", 792, 223, 0, "T\xc3\xbcrkiye", "\xd8\xaa\xd8\xb1\xd9\x83\xd9\x8a\xd8\xa7"},
+    {"TKM", "TM", 795, 213, 0, "Turkmenistan", "\xd8\xaa\xd8\xb1\xd9\x83\xd9\x85\xd8\xa7\xd9\x86\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"TCA", "TC", 796, 224, 0, "Turks and Caicos Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xaa\xd9\x88\xd8\xb1\xd9\x83\xd8\xb3 \xd9\x88\xd9\x83\xd8\xa7\xd9\x8a\xd9\x83\xd9\x88\xd8\xb3"},
+    {"TUV", "TV", 798, 227, 0, "Tuvalu", "\xd8\xaa\xd9\x88\xd9\x81\xd8\xa7\xd9\x84\xd9\x88"},
+    {"UGA", "UG", 800, 226, 22, "Uganda", "\xd8\xa3\xd9\x88\xd8\xba\xd9\x86\xd8\xaf\xd8\xa7"},
+    {"UKR", "UA", 804, 230, 0, "Ukraine", "\xd8\xa3\xd9\x88\xd9\x83\xd8\xb1\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa7"},
+    {"ARE", "AE", 784, 225, 0, "United Arab Emirates", "\xd8\xa7\xd9\x84\xd8\xa5\xd9\x85\xd8\xa7\xd8\xb1\xd8\xa7\xd8\xaa \xd8\xa7\xd9\x84\xd8\xb9\xd8\xb1\xd8\xa8\xd9\x8a\xd8\xa9 \xd8\xa7\xd9\x84\xd9\x85\xd8\xaa\xd8\xad\xd8\xaf\xd8\xa9"},
+    {"GBR", "GB", 826, 229, 0, "United Kingdom", "\xd8\xa7\xd9\x84\xd9\x85\xd9\x85\xd9\x84\xd9\x83\xd8\xa9 \xd8\xa7\xd9\x84\xd9\x85\xd8\xaa\xd8\xad\xd8\xaf\xd8\xa9"},
+    {"USA", "US", 840, 231, 0, "United States", "\xd8\xa7\xd9\x84\xd9\x88\xd9\x84\xd8\xa7\xd9\x8a\xd8\xa7\xd8\xaa \xd8\xa7\xd9\x84\xd9\x85\xd8\xaa\xd8\xad\xd8\xaf\xd8\xa9"},
+    {"UMI", "UM", 581, 0, 0, "United States Minor Outlying Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd9\x88\xd9\x84\xd8\xa7\xd9\x8a\xd8\xa7\xd8\xaa \xd8\xa7\xd9\x84\xd9\x85\xd8\xaa\xd8\xad\xd8\xaf\xd8\xa9 \xd8\xa7\xd9\x84\xd8\xb5\xd8\xba\xd9\x8a\xd8\xb1\xd8\xa9 \xd8\xa7\xd9\x84\xd9\x86\xd8\xa7\xd8\xa6\xd9\x8a\xd8\xa9"},
+    {"URY", "UY", 858, 234, 0, "Uruguay", "\xd8\xa7\xd9\x84\xd8\xa3\xd9\x88\xd8\xb1\xd9\x88\xd8\xba\xd9\x88\xd8\xa7\xd9\x8a"},
+    {"UZB", "UZ", 860, 235, 0, "Uzbekistan", "\xd8\xa3\xd9\x88\xd8\xb2\xd8\xa8\xd9\x83\xd8\xb3\xd8\xaa\xd8\xa7\xd9\x86"},
+    {"VUT", "VU", 548, 155, 0, "Vanuatu", "\xd9\x81\xd8\xa7\xd9\x86\xd9\x88\xd8\xa7\xd8\xaa\xd9\x88"},
+    {"VEN", "VE", 862, 236, 0, "Venezuela", "\xd9\x81\xd9\x86\xd8\xb2\xd9\x88\xd9\x8a\xd9\x84\xd8\xa7"},
+    {"VNM", "VN", 704, 237, 0, "Viet Nam", "\xd9\x81\xd9\x8a\xd8\xaa\xd9\x86\xd8\xa7\xd9\x85"},
+    {"VGB", "VG", 92, 239, 0, "British Virgin Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd8\xb9\xd8\xb0\xd8\xb1\xd8\xa7\xd8\xa1 \xd8\xa7\xd9\x84\xd8\xa8\xd8\xb1\xd9\x8a\xd8\xb7\xd8\xa7\xd9\x86\xd9\x8a\xd8\xa9"},
+    {"VIR", "VI", 850, 240, 0, "United States Virgin Islands", "\xd8\xac\xd8\xb2\xd8\xb1 \xd8\xa7\xd9\x84\xd8\xb9\xd8\xb0\xd8\xb1\xd8\xa7\xd8\xa1 \xd8\xa7\xd9\x84\xd8\xa3\xd9\x85\xd8\xb1\xd9\x8a\xd9\x83\xd9\x8a\xd8\xa9"},
+    {"WLF", "WF", 876, 243, 0, "Wallis and Futuna", "\xd9\x88\xd8\xa7\xd9\x84\xd9\x8a\xd8\xb3 \xd9\x88\xd9\x81\xd9\x88\xd8\xaa\xd9\x88\xd9\x86\xd8\xa7"},
+    {"ESH", "EH", 732, 205, 0, "Western Sahara", "\xd8\xa7\xd9\x84\xd8\xb5\xd8\xad\xd8\xb1\xd8\xa7\xd8\xa1 \xd8\xa7\xd9\x84\xd8\xba\xd8\xb1\xd8\xa8\xd9\x8a\xd8\xa9"},
+    {"YEM", "YE", 887, 249, 0, "Yemen", "\xd8\xa7\xd9\x84\xd9\x8a\xd9\x85\xd9\x86"},
+    {"ZMB", "ZM", 894, 251, 16, "Zambia", "\xd8\xb2\xd8\xa7\xd9\x85\xd8\xa8\xd9\x8a\xd8\xa7"},
+    {"ZWE", "ZW", 716, 181, 16, "Zimbabwe", "\xd8\xb2\xd9\x8a\xd9\x85\xd8\xa8\xd8\xa7\xd8\xa8\xd9\x88\xd9\x8a"},
+};
+
+static constexpr CountryGroup COUNTRY_GROUPS[] = {
+    {"NEIGHBORS", 1, "Countries bordering Sudan"},
+    {"IGAD", 2, "Intergovernmental Authority on Development"},
+    {"NILE_BASIN", 4, "Nile Basin countries"},
+    {"SAHEL", 8, "Sahel countries of the UN Integrated Strategy for the Sahel"},
+    {"AFRICA", 16, "The 54 African UN member states"},
+};
+
+// ISO3 perfect hash: bucket displacements and slot -> COUNTRIES index
+static constexpr uint16_t ISO3_DISPLACEMENTS[] = {
+    4, 1, 0, 2, 1, 1, 8, 2, 10, 1, 1, 1, 1, 2, 1, 1,
+    3, 1, 2, 3, 1, 2, 2, 4, 6, 3, 2, 1, 9, 3, 1, 3,
+    6, 7, 2, 2, 4, 1, 5, 3, 2, 7, 3, 3, 1, 4, 4, 6,
+    9, 2, 1, 2, 4, 1, 1, 2, 3, 3, 10, 4, 1, 11, 11, 3,
+};
+static constexpr uint16_t ISO3_SLOTS[] = {
+    144, 65535, 65535, 65535, 228, 65535, 65535, 65535, 33, 65535, 219, 65535, 65535, 65535, 239, 72,
+    65535, 65535, 131, 65535, 73, 65535, 65535, 65535, 46, 85, 108, 65535, 65535, 65535, 120, 65535,
+    65535, 136, 205, 226, 65535, 59, 65535, 16, 66, 233, 184, 38, 190, 65535, 13, 196,
+    128, 65535, 65535, 65535, 42, 94, 48, 65535, 65535, 65535, 93, 65535, 55, 65535, 65535, 65535,
+    65535, 23, 189, 186, 65535, 65535, 65535, 133, 65535, 65535, 229, 65535, 67, 65535, 88, 65535,
+    65535, 65535, 65535, 220, 65535, 146, 12, 11, 65535, 176, 109, 179, 65535, 65535, 65535, 117,
+    41, 65535, 65535, 230, 193, 65535, 40, 112, 6, 65535, 65535, 171, 65535, 122, 65535, 160,
+    65535, 227, 65535, 65535, 65535, 76, 65535, 65535, 197, 236, 81, 65535, 65535, 140, 65535, 34,
+    52, 65535, 65535, 65535, 62, 65535, 65535, 65535, 65535, 65535, 36, 65535, 65535, 187, 65535, 95,
+    105, 65535, 65535, 96, 65535, 65535, 65535, 155, 138, 39, 65535, 65535, 77, 65535, 80, 65535,
+    65535, 65535, 65535, 65535, 65535, 221, 101, 188, 65535, 65535, 65535, 141, 14, 65535, 5, 0,
+    65535, 139, 65535, 83, 126, 242, 56, 65535, 106, 24, 65535, 65535, 65535, 113, 147, 64,
+    61, 244, 65535, 65535, 180, 65535, 150, 169, 65535, 22, 65535, 65535, 65535, 243, 100, 68,
+    65535, 65535, 218, 65535, 132, 65535, 175, 65535, 65535, 65535, 65535, 84, 234, 2, 65535, 191,
+    65535, 99, 162, 172, 222, 10, 32, 65535, 21, 65535, 65535, 31, 116, 89, 198, 65535,
+    65535, 65535, 65535, 65535, 65535, 170, 212, 65535, 65535, 213, 125, 65535, 74, 210, 232, 65,
+    65535, 65535, 65535, 65535, 65535, 65535, 142, 65535, 65535, 137, 65535, 65535, 9, 58, 124, 248,
+    65535, 65535, 65535, 65535, 91, 65535, 65535, 65535, 75, 224, 178, 65535, 149, 65535, 1, 65535,
+    102, 69, 65535, 65535, 161, 65535, 65535, 65535, 201, 65535, 181, 54, 185, 65535, 167, 87,
+    65535, 143, 235, 98, 145, 79, 65535, 114, 65535, 214, 65535, 164, 134, 65535, 65535, 71,
+    65535, 247, 65535, 65535, 65535, 65535, 65535, 65535, 151, 65535, 65535, 174, 65535, 135, 148, 86,
+    200, 246, 65535, 65535, 111, 65535, 202, 65535, 65535, 119, 65535, 238, 65535, 65535, 18, 65535,
+    65535, 204, 208, 65535, 50, 57, 182, 65535, 65535, 65535, 65535, 65535, 4, 70, 15, 19,
+    203, 65535, 183, 118, 53, 65535, 65535, 231, 177, 65535, 65535, 65535, 192, 44, 65535, 49,
+    65535, 65535, 157, 154, 65535, 65535, 65535, 65535, 65535, 107, 115, 28, 65535, 47, 65535, 237,
+    127, 26, 65535, 60, 65535, 65535, 65535, 223, 65535, 225, 65535, 65535, 51, 65535, 158, 65535,
+    195, 130, 159, 65535, 27, 245, 65535, 209, 7, 65535, 65535, 65535, 65535, 65535, 206, 65535,
+    63, 65535, 152, 37, 173, 241, 65535, 43, 65535, 92, 17, 240, 65535, 3, 129, 207,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 20, 65535, 65535, 65535, 97, 65535, 25, 65535, 104,
+    65535, 123, 103, 65535, 163, 65535, 168, 211, 65535, 65535, 29, 65535, 199, 65535, 65535, 65535,
+    65535, 110, 216, 65535, 65535, 166, 8, 65535, 156, 153, 65535, 90, 45, 30, 35, 65535,
+    82, 217, 65535, 121, 65535, 65535, 215, 65535, 194, 65535, 65535, 78, 65535, 165, 65535, 65535,
+};
+
+// ISO2 perfect hash: bucket displacements and slot -> COUNTRIES index
+static constexpr uint16_t ISO2_DISPLACEMENTS[] = {
+    1, 1, 1, 1, 4, 3, 8, 1, 1, 1, 5, 5, 4, 15, 1, 10,
+    4, 1, 8, 4, 7, 1, 3, 3, 1, 1, 2, 2, 2, 2, 1, 1,
+    1, 5, 1, 2, 5, 7, 3, 1, 1, 1, 1, 1, 1, 21, 5, 13,
+    7, 1, 0, 20, 7, 1, 2, 2, 2, 1, 15, 5, 1, 9, 23, 5,
+};
+static constexpr uint16_t ISO2_SLOTS[] = {
+    65535, 29, 126, 65535, 154, 65535, 65535, 65535, 65535, 61, 8, 65535, 65535, 65535, 88, 65535,
+    177, 65535, 108, 118, 65535, 65535, 65535, 65535, 65535, 121, 185, 145, 195, 65535, 65535, 83,
+    65535, 223, 59, 65535, 75, 65535, 98, 65535, 65535, 65535, 57, 65535, 102, 65535, 65535, 100,
+    235, 169, 56, 194, 82, 17, 65535, 65535, 65535, 166, 197, 65535, 117, 70, 65535, 221,
+    129, 157, 79, 242, 65535, 65535, 246, 186, 85, 219, 93, 89, 65535, 243, 65535, 65535,
+    187, 65535, 25, 65535, 65535, 183, 65535, 65535, 65535, 174, 65535, 238, 35, 119, 65535, 65535,
+    65535, 65535, 99, 171, 65535, 65535, 132, 45, 149, 65535, 200, 65535, 65535, 26, 65535, 65535,
+    65535, 141, 214, 16, 65535, 94, 52, 107, 65535, 65535, 65535, 161, 65535, 208, 120, 147,
+    65535, 5, 65535, 65535, 74, 65535, 65535, 63, 72, 143, 65535, 65535, 65535, 65535, 218, 191,
+    96, 65535, 65535, 65535, 167, 65535, 86, 182, 12, 137, 65535, 65535, 65535, 65535, 66, 65535,
+    164, 234, 7, 65535, 110, 217, 65535, 65535, 65535, 65535, 148, 65535, 39, 38, 65535, 65535,
+    65535, 114, 65535, 65535, 203, 65535, 65535, 11, 67, 65535, 65535, 248, 65535, 65535, 65535, 173,
+    209, 65535, 65535, 65535, 65535, 65535, 227, 65535, 65535, 224, 207, 65535, 130, 65535, 49, 111,
+    65535, 34, 124, 51, 65535, 204, 188, 65535, 65535, 65535, 211, 65535, 65535, 65535, 65535, 65535,
+    31, 65535, 65535, 84, 65535, 112, 22, 46, 163, 65535, 179, 65535, 131, 77, 233, 65535,
+    65535, 152, 65535, 116, 33, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 206, 48, 65535,
+    193, 65535, 65535, 65535, 90, 1, 65535, 134, 65535, 142, 236, 239, 41, 65535, 65535, 23,
+    65535, 125, 65535, 65535, 65535, 21, 65535, 201, 127, 65535, 65535, 122, 76, 47, 65535, 65535,
+    65535, 165, 50, 65535, 65535, 65535, 65535, 65535, 65535, 37, 65535, 65535, 30, 65535, 3, 87,
+    6, 65535, 65535, 65535, 65535, 65535, 241, 155, 146, 10, 80, 103, 65535, 36, 42, 153,
+    205, 245, 65535, 65535, 181, 62, 65535, 65535, 196, 65535, 180, 133, 231, 65535, 192, 65535,
+    54, 14, 65535, 65535, 58, 159, 65535, 65535, 162, 65535, 65, 65535, 65535, 65535, 65535, 170,
+    65535, 172, 69, 115, 65535, 226, 65535, 65535, 220, 65535, 65535, 244, 158, 65535, 65535, 65535,
+    65535, 68, 65535, 135, 65535, 53, 156, 176, 178, 65535, 65535, 65535, 65535, 65535, 55, 198,
+    44, 65535, 213, 65535, 95, 65535, 202, 65535, 65535, 229, 19, 97, 40, 65535, 139, 65535,
+    216, 60, 65535, 65535, 65535, 65535, 65535, 65535, 168, 27, 65535, 20, 81, 65535, 65535, 65535,
+    65535, 160, 65535, 228, 65535, 136, 4, 65535, 32, 210, 65535, 65535, 65535, 24, 128, 65535,
+    65535, 65535, 109, 65535, 65535, 232, 65535, 215, 65535, 65535, 65535, 65535, 91, 190, 101, 105,
+    65535, 65535, 65535, 65535, 65535, 71, 65535, 18, 9, 104, 123, 73, 212, 140, 78, 138,
+    240, 151, 65535, 65535, 65535, 247, 43, 65535, 222, 65535, 65535, 65535, 65535, 113, 175, 15,
+    65535, 65535, 237, 65535, 65535, 13, 106, 65535, 28, 2, 65535, 65535, 225, 150, 184, 65535,
+    64, 65535, 65535, 65535, 65535, 230, 65535, 65535, 65535, 189, 144, 199, 65535, 0, 65535, 92,
+};
+
+// M49 perfect hash: bucket displacements and slot -> COUNTRIES index
+static constexpr uint16_t M49_DISPLACEMENTS[] = {
+    1, 11, 3, 3, 8, 4, 1, 4, 1, 8, 18, 1, 7, 3, 1, 5,
+    18, 1, 3, 4, 1, 0, 3, 13, 4, 8, 4, 10, 1, 4, 13, 11,
+    4, 1, 24, 12, 3, 1, 4, 4, 18, 4, 7, 10, 6, 1, 8, 1,
+    13, 17, 22, 1, 3, 1, 3, 11, 1, 10, 1, 5, 4, 8, 1, 7,
+};
+static constexpr uint16_t M49_SLOTS[] = {
+    65535, 248, 65535, 10, 65535, 210, 41, 65535, 65535, 189, 56, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 52, 65535, 65535, 156, 14, 65535, 65535, 65535, 65535, 65535, 65535, 106, 157,
+    241, 65535, 65535, 122, 16, 65, 176, 65535, 196, 65535, 169, 200, 82, 4, 90, 119,
+    65535, 65535, 65535, 107, 139, 140, 152, 65535, 65535, 29, 65535, 19, 182, 112, 65535, 228,
+    77, 65535, 178, 151, 160, 65535, 66, 147, 33, 130, 65535, 126, 121, 65535, 65535, 65535,
+    150, 101, 96, 65535, 42, 80, 65535, 65535, 65535, 65535, 35, 65535, 104, 65535, 65535, 51,
+    188, 172, 158, 65535, 38, 191, 39, 65535, 232, 225, 163, 73, 11, 65535, 20, 65535,
+    69, 65535, 153, 65535, 65535, 25, 144, 65535, 65535, 203, 89, 116, 65535, 12, 65535, 65535,
+    86, 30, 75, 154, 168, 238, 179, 21, 65535, 114, 65535, 65535, 65535, 65535, 1, 65535,
+    65535, 71, 65535, 65535, 165, 65535, 65535, 78, 65535, 65535, 65535, 65535, 27, 109, 65535, 65535,
+    65535, 65535, 199, 242, 185, 8, 173, 124, 65535, 65535, 133, 65535, 65535, 70, 5, 65535,
+    64, 180, 65535, 65535, 65535, 138, 65535, 65535, 92, 60, 65535, 131, 65535, 65535, 195, 65535,
+    65535, 26, 65535, 65535, 79, 36, 65535, 34, 65535, 159, 65535, 135, 65535, 65535, 65535, 155,
+    125, 65535, 97, 57, 65535, 65535, 102, 184, 197, 215, 123, 65535, 65535, 65535, 65535, 65535,
+    237, 65535, 65535, 65535, 65535, 65535, 23, 65535, 65535, 40, 65535, 45, 65535, 65535, 230, 74,
+    44, 65535, 87, 244, 91, 65535, 148, 111, 223, 65535, 187, 32, 0, 50, 65535, 149,
+    53, 170, 65535, 65535, 88, 120, 65535, 63, 65535, 177, 65535, 175, 65535, 65535, 110, 65535,
+    65535, 174, 28, 81, 65535, 6, 65535, 47, 65535, 54, 65535, 208, 192, 65535, 231, 65535,
+    65535, 164, 65535, 99, 190, 65535, 65535, 95, 65535, 65535, 83, 117, 65535, 65535, 65535, 22,
+    65535, 65535, 65535, 65535, 2, 65535, 65535, 65535, 65535, 65535, 24, 65535, 65535, 65535, 118, 65535,
+    239, 65535, 65535, 204, 65535, 65535, 65535, 218, 206, 65535, 145, 7, 65535, 171, 233, 65535,
+    65535, 103, 65535, 65535, 65535, 59, 216, 65535, 65535, 137, 224, 65535, 198, 65535, 65535, 193,
+    65535, 18, 65535, 65535, 65535, 227, 65535, 65535, 98, 234, 15, 132, 94, 65535, 49, 100,
+    65535, 37, 65535, 65535, 65535, 127, 134, 85, 201, 65535, 65535, 226, 65535, 65535, 65535, 167,
+    55, 65535, 240, 76, 65535, 65535, 65535, 65535, 211, 65535, 65535, 65535, 65535, 65535, 65535, 48,
+    65535, 13, 65535, 65535, 65535, 65535, 65535, 105, 65535, 65535, 65535, 65535, 65535, 65535, 161, 202,
+    65535, 205, 229, 219, 65535, 65535, 246, 65535, 65535, 65535, 212, 166, 3, 72, 65535, 65535,
+    65535, 217, 214, 181, 68, 65535, 65535, 186, 9, 65535, 61, 43, 17, 58, 31, 65535,
+    65535, 65535, 65535, 65535, 128, 65535, 209, 65535, 65535, 236, 65535, 65535, 65535, 65535, 221, 183,
+    65535, 65535, 65535, 213, 65535, 84, 65535, 65535, 245, 65535, 129, 220, 65535, 115, 65535, 65535,
+    65535, 62, 65535, 65535, 143, 108, 65535, 141, 162, 65535, 65535, 65535, 235, 65535, 222, 113,
+    65535, 194, 65535, 247, 243, 67, 93, 65535, 136, 65535, 65535, 146, 46, 142, 207, 65535,
+};
+
+} // namespace sudan
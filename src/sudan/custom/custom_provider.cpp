@@ -0,0 +1,662 @@
+#include "custom_provider.hpp"
+#include "function_builder.hpp"
+
+// DuckDB
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "yyjson.hpp"
+using namespace duckdb_yyjson; // NOLINT
+
+#include <algorithm>
+
+// SUDAN
+#include "sudan/providers.hpp"
+#include "sudan/provider_scan.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// JSON Helpers
+//======================================================================================================================
+
+static vector<string> SplitPath(const string &path) {
+	vector<string> result;
+	if (path.empty()) {
+		return result;
+	}
+	return StringUtil::Split(path, '.');
+}
+
+//! Follow a path of object keys and array indexes. Returns nullptr if any step is missing.
+static yyjson_val *ResolvePath(yyjson_val *val, const vector<string> &path) {
+	for (auto &step : path) {
+		if (yyjson_is_obj(val)) {
+			val = yyjson_obj_getn(val, step.c_str(), step.size());
+		} else if (yyjson_is_arr(val)) {
+			idx_t index;
+			try {
+				index = std::stoul(step);
+			} catch (...) {
+				return nullptr;
+			}
+			val = yyjson_arr_get(val, index);
+		} else {
+			return nullptr;
+		}
+		if (!val) {
+			return nullptr;
+		}
+	}
+	return val;
+}
+
+static string GetSpecString(yyjson_val *obj, const char *key, const string &default_value) {
+	auto val = yyjson_obj_get(obj, key);
+	if (!val) {
+		return default_value;
+	}
+	if (!yyjson_is_str(val)) {
+		throw InvalidInputException("SUDAN: Custom provider field '%s' must be a string.", key);
+	}
+	return yyjson_get_str(val);
+}
+
+static idx_t GetSpecCount(yyjson_val *obj, const char *key, idx_t default_value) {
+	auto val = yyjson_obj_get(obj, key);
+	if (!val) {
+		return default_value;
+	}
+	if (!yyjson_is_uint(val) || yyjson_get_uint(val) == 0) {
+		throw InvalidInputException("SUDAN: Custom provider field '%s' must be a positive integer.", key);
+	}
+	return yyjson_get_uint(val);
+}
+
+//======================================================================================================================
+// CustomProviderSpec
+//======================================================================================================================
+
+static CustomProviderSpec ParseSpecObject(yyjson_val *root) {
+	if (!yyjson_is_obj(root)) {
+		throw InvalidInputException("SUDAN: A custom provider spec must be a JSON object.");
+	}
+
+	CustomProviderSpec spec;
+	spec.name = StringUtil::Lower(GetSpecString(root, "name", ""));
+	if (spec.name.empty()) {
+		throw InvalidInputException("SUDAN: Custom provider spec is missing 'name'.");
+	}
+
+	spec.url_template = GetSpecString(root, "url", "");
+	auto scheme_end = spec.url_template.find("://");
+	if (scheme_end == string::npos) {
+		throw InvalidInputException("SUDAN: Custom provider '%s' needs an absolute http(s) 'url'.", spec.name);
+	}
+	spec.base_url = spec.url_template.substr(0, spec.url_template.find('/', scheme_end + 3));
+
+	auto country_format = StringUtil::Lower(GetSpecString(root, "country_format", "iso3"));
+	if (country_format != "iso3" && country_format != "iso2") {
+		throw InvalidInputException("SUDAN: Custom provider 'country_format' must be 'iso3' or 'iso2'.");
+	}
+	spec.country_iso2 = country_format == "iso2";
+
+	auto batch = yyjson_obj_get(root, "batch");
+	if (batch) {
+		spec.batch_size = GetSpecCount(batch, "size", spec.batch_size);
+		spec.batch_separator = GetSpecString(batch, "separator", spec.batch_separator);
+	}
+	spec.rows_path = SplitPath(GetSpecString(root, "rows", ""));
+
+	auto pagination = yyjson_obj_get(root, "pagination");
+	if (pagination) {
+		auto style = StringUtil::Lower(GetSpecString(pagination, "style", "none"));
+		if (style == "page") {
+			spec.pagination = CustomPaginationStyle::PAGE;
+		} else if (style == "offset") {
+			spec.pagination = CustomPaginationStyle::OFFSET;
+		} else if (style != "none") {
+			throw InvalidInputException("SUDAN: Custom provider pagination style must be 'none', 'page' or 'offset'.");
+		}
+		spec.page_size = GetSpecCount(pagination, "page_size", spec.page_size);
+		spec.max_pages = GetSpecCount(pagination, "max_pages", spec.max_pages);
+	}
+	// Without its placeholder every page would request the same URL, repeating the first page's rows
+	auto placeholder = spec.pagination == CustomPaginationStyle::PAGE     ? "{page}"
+	                   : spec.pagination == CustomPaginationStyle::OFFSET ? "{offset}"
+	                                                                      : "";
+	if (*placeholder && spec.url_template.find(placeholder) == string::npos) {
+		throw InvalidInputException("SUDAN: Custom provider '%s' uses %s pagination but its 'url' has no %s.",
+		                            spec.name, StringUtil::Lower(GetSpecString(pagination, "style", "")),
+		                            placeholder);
+	}
+	spec.has_country = spec.url_template.find("{country}") != string::npos;
+
+	auto year_filter = yyjson_obj_get(root, "year_filter");
+	if (year_filter) {
+		spec.year_start_param = GetSpecString(year_filter, "start_param", "");
+		spec.year_end_param = GetSpecString(year_filter, "end_param", "");
+	}
+
+	auto columns = yyjson_obj_get(root, "columns");
+	if (!yyjson_is_arr(columns) || yyjson_arr_size(columns) == 0) {
+		throw InvalidInputException("SUDAN: Custom provider '%s' needs a non-empty 'columns' array.", spec.name);
+	}
+	size_t idx, max;
+	yyjson_val *column;
+	yyjson_arr_foreach(columns, idx, max, column) {
+		CustomProviderColumn result;
+		result.name = GetSpecString(column, "name", "");
+		if (result.name.empty()) {
+			throw InvalidInputException("SUDAN: Every column of custom provider '%s' needs a 'name'.", spec.name);
+		}
+		result.path = SplitPath(GetSpecString(column, "path", result.name));
+
+		auto type = StringUtil::Upper(GetSpecString(column, "type", "VARCHAR"));
+		if (type == "VARCHAR") {
+			result.type = LogicalType::VARCHAR;
+		} else if (type == "INTEGER") {
+			result.type = LogicalType::INTEGER;
+		} else if (type == "BIGINT") {
+			result.type = LogicalType::BIGINT;
+		} else if (type == "DOUBLE") {
+			result.type = LogicalType::DOUBLE;
+		} else {
+			throw InvalidInputException(
+			    "SUDAN: Unsupported type '%s' for column '%s'. Use VARCHAR, INTEGER, BIGINT or DOUBLE.", type,
+			    result.name);
+		}
+		spec.columns.push_back(std::move(result));
+	}
+	return spec;
+}
+
+CustomProviderSpec CustomProviderSpec::Parse(const string &json) {
+	auto doc = yyjson_read(json.c_str(), json.size(), YYJSON_READ_NOFLAG);
+	if (!doc) {
+		throw InvalidInputException("SUDAN: Custom provider spec is not valid JSON.");
+	}
+	try {
+		auto spec = ParseSpecObject(yyjson_doc_get_root(doc));
+		yyjson_doc_free(doc);
+		return spec;
+	} catch (...) {
+		yyjson_doc_free(doc);
+		throw;
+	}
+}
+
+//======================================================================================================================
+// CustomProviderRegistry
+//======================================================================================================================
+
+void CustomProviderRegistry::Register(shared_ptr<const CustomProviderSpec> spec) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	providers_[spec->name] = std::move(spec);
+}
+
+shared_ptr<const CustomProviderSpec> CustomProviderRegistry::Lookup(const string &name) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = providers_.find(StringUtil::Lower(name));
+	if (it == providers_.end()) {
+		return nullptr;
+	}
+	return it->second;
+}
+
+vector<string> CustomProviderRegistry::Names() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	vector<string> names;
+	for (auto &entry : providers_) {
+		names.push_back(entry.first);
+	}
+	std::sort(names.begin(), names.end());
+	return names;
+}
+
+CustomProviderRegistry &CustomProviderRegistry::Instance() {
+	static CustomProviderRegistry instance;
+	return instance;
+}
+
+namespace {
+
+//======================================================================================================================
+// SUDAN_Provider
+//======================================================================================================================
+
+struct SudanCustomProvider {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct BindData final : ProviderScanBindData {
+		//! Kept alive even if the provider is replaced while the query runs
+		shared_ptr<const CustomProviderSpec> spec;
+
+		BindData(shared_ptr<const CustomProviderSpec> spec_p, vector<string> args, vector<string> countries,
+		         vector<LogicalType> types, idx_t year_column)
+		    : ProviderScanBindData(std::move(args), std::move(countries), std::move(types), year_column),
+		      spec(std::move(spec_p)) {
+		}
+	};
+
+	//! Countries per request. A URL without {country} is the same for every country, so it is fetched once.
+	static idx_t BatchSize(const BindData &bind_data) {
+		if (!bind_data.spec->has_country) {
+			return MaxValue<idx_t>(bind_data.countries.size(), 1);
+		}
+		return bind_data.spec->batch_size;
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		const string name = StringValue::Get(input.inputs[0]);
+		auto spec = CustomProviderRegistry::Instance().Lookup(name);
+		if (!spec) {
+			auto registered = CustomProviderRegistry::Instance().Names();
+			throw InvalidInputException("SUDAN: Unknown custom provider '%s'. Registered providers: %s.", name,
+			                            registered.empty() ? "(none)" : StringUtil::Join(registered, ", "));
+		}
+
+		vector<string> args;
+		if (input.inputs.size() > 1) {
+			args.push_back(StringValue::Get(input.inputs[1]));
+		}
+		if (args.empty() && spec->url_template.find("{arg}") != string::npos) {
+			throw InvalidInputException("SUDAN: Custom provider '%s' requires an argument for {arg} in its URL.",
+			                            spec->name);
+		}
+
+		idx_t year_column = DConstants::INVALID_INDEX;
+		idx_t country_column = DConstants::INVALID_INDEX;
+		for (idx_t i = 0; i < spec->columns.size(); i++) {
+			names.push_back(spec->columns[i].name);
+			return_types.push_back(spec->columns[i].type);
+			// Either bound narrows the download; the filter itself stays in place
+			if (spec->columns[i].name == "year" &&
+			    (!spec->year_start_param.empty() || !spec->year_end_param.empty())) {
+				year_column = i;
+			}
+			if (spec->columns[i].name == "country") {
+				country_column = i;
+			}
+		}
+
+		auto countries = ProviderScanBindData::ParseCountries(input.named_parameters);
+		auto bind_data = make_uniq<BindData>(spec, std::move(args), std::move(countries), return_types, year_column);
+		bind_data->country_column = country_column;
+		bind_data->ParseSorted(input.named_parameters, BatchSize(*bind_data));
+		return std::move(bind_data);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Fetch
+	//------------------------------------------------------------------------------------------------------------------
+
+	static bool TryGetInteger(yyjson_val *val, int64_t &result) {
+		if (yyjson_is_int(val)) {
+			result = yyjson_get_sint(val);
+			return true;
+		}
+		if (yyjson_is_real(val)) {
+			result = static_cast<int64_t>(yyjson_get_real(val));
+			return true;
+		}
+		if (yyjson_is_str(val)) {
+			try {
+				result = std::stoll(yyjson_get_str(val));
+				return true;
+			} catch (...) {
+			}
+		}
+		return false;
+	}
+
+	static void WriteCell(ProviderRowWriter &writer, idx_t col, const LogicalType &type, yyjson_val *val) {
+		if (!val || yyjson_is_null(val)) {
+			return;
+		}
+		switch (type.id()) {
+		case LogicalTypeId::VARCHAR:
+			if (yyjson_is_str(val)) {
+				writer.SetString(col, yyjson_get_str(val));
+			} else if (yyjson_is_int(val)) {
+				writer.SetString(col, std::to_string(yyjson_get_sint(val)));
+			} else if (yyjson_is_real(val)) {
+				writer.SetString(col, Value::DOUBLE(yyjson_get_real(val)).ToString());
+			} else if (yyjson_is_bool(val)) {
+				writer.SetString(col, yyjson_get_bool(val) ? "true" : "false");
+			}
+			break;
+		case LogicalTypeId::INTEGER: {
+			int64_t result;
+			if (TryGetInteger(val, result)) {
+				writer.SetInteger(col, static_cast<int32_t>(result));
+			}
+			break;
+		}
+		case LogicalTypeId::BIGINT: {
+			int64_t result;
+			if (TryGetInteger(val, result)) {
+				writer.SetBigint(col, result);
+			}
+			break;
+		}
+		case LogicalTypeId::DOUBLE:
+			if (yyjson_is_num(val)) {
+				writer.SetDouble(col, yyjson_get_num(val));
+			} else if (yyjson_is_str(val)) {
+				try {
+					writer.SetDouble(col, std::stod(yyjson_get_str(val)));
+				} catch (...) {
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	//! Parse one response into rows, returns the number of row objects in the page
+	static idx_t ParsePage(const CustomProviderSpec &spec, const string &body, ProviderRowWriter &writer) {
+		auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
+		if (!json_data) {
+			return 0;
+		}
+
+		auto rows_arr = ResolvePath(yyjson_doc_get_root(json_data), spec.rows_path);
+		if (!yyjson_is_arr(rows_arr)) {
+			yyjson_doc_free(json_data);
+			return 0;
+		}
+
+		size_t idx, max;
+		yyjson_val *elem;
+		yyjson_arr_foreach(rows_arr, idx, max, elem) {
+			writer.NewRow();
+			for (idx_t col = 0; col < spec.columns.size(); col++) {
+				auto &column = spec.columns[col];
+				WriteCell(writer, col, column.type, ResolvePath(elem, column.path));
+			}
+		}
+
+		auto page_rows = yyjson_arr_size(rows_arr);
+		yyjson_doc_free(json_data);
+		return page_rows;
+	}
+
+	static void Fetch(const HttpSettings &settings, const ProviderScanBindData &bind_data_p,
+	                  const vector<string> &countries, ProviderRowWriter &writer) {
+		auto &bind_data = bind_data_p.Cast<BindData>();
+		auto &spec = *bind_data.spec;
+
+		// Substituted values are URL-encoded, the separator between countries is the provider's syntax
+		vector<string> codes;
+		for (auto &country_iso3 : countries) {
+			auto info = spec.country_iso2 ? sudan::FindCountryByISO3(country_iso3) : nullptr;
+			codes.push_back(StringUtil::URLEncode(info ? info->iso2 : country_iso3));
+		}
+
+		string url_base =
+		    StringUtil::Replace(spec.url_template, "{country}", StringUtil::Join(codes, spec.batch_separator));
+		if (!bind_data.args.empty()) {
+			url_base = StringUtil::Replace(url_base, "{arg}", StringUtil::URLEncode(bind_data.args[0]));
+		}
+		url_base = StringUtil::Replace(url_base, "{limit}", std::to_string(spec.page_size));
+
+		auto &year_filter = bind_data.year_filter;
+		if (year_filter.has_year_filter) {
+			auto separator = url_base.find('?') == string::npos ? "?" : "&";
+			if (year_filter.year_start > 0 && !spec.year_start_param.empty()) {
+				url_base += separator + spec.year_start_param + "=" + std::to_string(year_filter.year_start);
+				separator = "&";
+			}
+			if (year_filter.year_end > 0 && !spec.year_end_param.empty()) {
+				url_base += separator + spec.year_end_param + "=" + std::to_string(year_filter.year_end);
+			}
+		}
+
+		auto page_count = spec.pagination == CustomPaginationStyle::NONE ? 1 : spec.max_pages;
+		for (idx_t page = 0; page < page_count; page++) {
+			string url = StringUtil::Replace(url_base, "{page}", std::to_string(page + 1));
+			url = StringUtil::Replace(url, "{offset}", std::to_string(page * spec.page_size));
+
+			string body;
+			if (!FetchCached(settings, url, body)) {
+				return;
+			}
+			// A short page is the last one
+			if (ParsePage(spec, body, writer) < spec.page_size) {
+				return;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+
+		HttpSettings settings = HttpClient::ExtractHttpSettings(context, bind_data.spec->base_url);
+
+		return ProviderScanState::Start(context, "SUDAN_Provider('" + bind_data.spec->name + "')", settings, bind_data,
+		                                Fetch, BatchSize(bind_data));
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Reads data from a custom provider registered with SUDAN_RegisterProvider().
+		The optional second argument is substituted for {arg} in the provider URL.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT * FROM SUDAN_Provider('hdx_population', countries := ['SDN', 'SSD']);
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		TableFunctionSet set("SUDAN_Provider");
+		for (auto &arguments : {vector<LogicalType> {LogicalType::VARCHAR},
+		                        vector<LogicalType> {LogicalType::VARCHAR, LogicalType::VARCHAR}}) {
+			TableFunction func("SUDAN_Provider", arguments, ProviderScanExecute, Bind, Init);
+			ProviderScanSetup(func);
+			set.AddFunction(func);
+		}
+
+		RegisterFunction<TableFunctionSet>(loader, set, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE,
+		                                   tags);
+	}
+};
+
+//======================================================================================================================
+// SUDAN_RegisterProvider
+//======================================================================================================================
+
+struct SudanRegisterProvider {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct BindData final : TableFunctionData {
+		vector<shared_ptr<const CustomProviderSpec>> specs;
+	};
+
+	//! Read a spec file; a file may hold a single spec object or an array of them
+	static vector<string> ReadSpecFile(ClientContext &context, const string &path) {
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		auto size = handle->GetFileSize();
+		string contents(size, '\0');
+		handle->Read((void *)contents.data(), size);
+
+		auto doc = yyjson_read(contents.c_str(), contents.size(), YYJSON_READ_NOFLAG);
+		if (!doc) {
+			throw InvalidInputException("SUDAN: Custom provider file '%s' is not valid JSON.", path);
+		}
+		vector<string> specs;
+		auto root = yyjson_doc_get_root(doc);
+		if (yyjson_is_arr(root)) {
+			size_t idx, max;
+			yyjson_val *elem;
+			yyjson_arr_foreach(root, idx, max, elem) {
+				size_t len;
+				auto json = yyjson_val_write(elem, YYJSON_WRITE_NOFLAG, &len);
+				specs.emplace_back(json, len);
+				free(json);
+			}
+		} else {
+			specs.push_back(contents);
+		}
+		yyjson_doc_free(doc);
+		return specs;
+	}
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		const string source = StringValue::Get(input.inputs[0]);
+		auto first = source.find_first_not_of(" \t\r\n");
+		if (first == string::npos) {
+			throw InvalidInputException("SUDAN: The spec parameter cannot be empty for SUDAN_RegisterProvider().");
+		}
+
+		// Inline JSON starts with '{', anything else is a path to a spec file
+		vector<string> json_specs;
+		if (source[first] == '{') {
+			json_specs.push_back(source);
+		} else {
+			json_specs = ReadSpecFile(context, source);
+		}
+
+		auto result = make_uniq<BindData>();
+		for (auto &json : json_specs) {
+			result->specs.push_back(make_shared_ptr<CustomProviderSpec>(CustomProviderSpec::Parse(json)));
+		}
+
+		names.emplace_back("name");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("base_url");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("columns");
+		return_types.push_back(LogicalType::LIST(LogicalType::VARCHAR));
+
+		return std::move(result);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct State final : GlobalTableFunctionState {
+		idx_t current_idx;
+		explicit State() : current_idx(0) {
+		}
+	};
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+
+		// Registration takes effect when the statement runs, not when it is bound
+		for (auto &spec : bind_data.specs) {
+			CustomProviderRegistry::Instance().Register(spec);
+		}
+		return make_uniq_base<GlobalTableFunctionState, State>();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto &state = input.global_state->Cast<State>();
+
+		idx_t count = 0;
+		auto next_idx = MinValue<idx_t>(state.current_idx + STANDARD_VECTOR_SIZE, bind_data.specs.size());
+
+		for (; state.current_idx < next_idx; state.current_idx++) {
+			const auto &spec = *bind_data.specs[state.current_idx];
+
+			vector<Value> columns;
+			for (auto &column : spec.columns) {
+				columns.emplace_back(column.name + " " + column.type.ToString());
+			}
+
+			output.data[0].SetValue(count, spec.name);
+			output.data[1].SetValue(count, spec.base_url);
+			output.data[2].SetValue(count, Value::LIST(LogicalType::VARCHAR, std::move(columns)));
+			count++;
+		}
+		output.SetCardinality(count);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Registers a custom JSON data provider from an inline JSON spec or a spec file (a single spec or an array).
+		Registered providers are queried with SUDAN_Provider(name) and get the same concurrent fetching,
+		caching and year filter pushdown as the built-in providers.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT * FROM SUDAN_RegisterProvider('{
+		    "name": "hdx_population",
+		    "url": "https://api.example.org/v1/population?country={country}&page={page}",
+		    "rows": "data",
+		    "pagination": {"style": "page", "page_size": 100},
+		    "columns": [{"name": "year", "type": "INTEGER"}, {"name": "value", "path": "total", "type": "DOUBLE"}]
+		}');
+
+		-- Or load specs from a file
+		SELECT * FROM SUDAN_RegisterProvider('providers/hdx.json');
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		const TableFunction func("SUDAN_RegisterProvider", {LogicalType::VARCHAR}, Execute, Bind, Init);
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+	}
+};
+
+} // namespace
+
+//======================================================================================================================
+// Register Custom Provider Functions
+//======================================================================================================================
+
+void CustomProviderFunctions::Register(ExtensionLoader &loader) {
+	SudanRegisterProvider::Register(loader);
+	SudanCustomProvider::Register(loader);
+}
+
+} // namespace duckdb
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+class ExtensionLoader;
+
+//======================================================================================================================
+// Custom Provider Spec
+//======================================================================================================================
+//
+// A declarative description of a JSON API, registered at runtime with SUDAN_RegisterProvider():
+//
+//   {
+//     "name": "hdx_population",
+//     "url": "https://api.example.org/v1/population?country={country}&page={page}",
+//     "country_format": "iso3",                       -- iso3 (default) or iso2
+//     "batch": {"size": 20, "separator": ","},        -- {country} may hold a list of countries
+//     "rows": "data.items",                           -- path to the row array ("" for a top-level array)
+//     "pagination": {"style": "page", "page_size": 100, "max_pages": 20},
+//     "year_filter": {"start_param": "yearFrom", "end_param": "yearTo"},
+//     "columns": [
+//       {"name": "year",  "path": "reference_year", "type": "INTEGER"},
+//       {"name": "value", "path": "stats.total",    "type": "DOUBLE"}
+//     ]
+//   }
+//
+// URL templates may use {country}, {arg}, {page}, {offset} and {limit}. Paths are dot-separated object keys or array
+// indexes. Column types are VARCHAR, INTEGER, BIGINT or DOUBLE.
+
+enum class CustomPaginationStyle : uint8_t { NONE, PAGE, OFFSET };
+
+struct CustomProviderColumn {
+	string name;
+	//! Path of the value inside a row object
+	vector<string> path;
+	LogicalType type;
+};
+
+struct CustomProviderSpec {
+	string name;
+	string url_template;
+	//! Scheme and host of url_template, used to resolve proxy and HTTP settings
+	string base_url;
+	bool country_iso2 = false;
+	//! Countries substituted into one {country} placeholder, joined by batch_separator
+	idx_t batch_size = 1;
+	string batch_separator = ",";
+	//! Whether url_template has a {country} placeholder
+	bool has_country = true;
+	vector<string> rows_path;
+	CustomPaginationStyle pagination = CustomPaginationStyle::NONE;
+	idx_t page_size = 100;
+	idx_t max_pages = 100;
+	string year_start_param;
+	string year_end_param;
+	vector<CustomProviderColumn> columns;
+
+	//! Parse and validate a JSON spec. Throws InvalidInputException on malformed specs.
+	static CustomProviderSpec Parse(const string &json);
+};
+
+//======================================================================================================================
+// Custom Provider Registry
+//======================================================================================================================
+
+//! Process-wide registry of custom providers, shared by all connections like the response cache
+class CustomProviderRegistry {
+public:
+	//! Register (or replace) a provider
+	void Register(shared_ptr<const CustomProviderSpec> spec);
+
+	//! Lookup a provider by name (case-insensitive). Returns nullptr if unknown.
+	shared_ptr<const CustomProviderSpec> Lookup(const string &name);
+
+	//! Names of all registered providers
+	vector<string> Names();
+
+	static CustomProviderRegistry &Instance();
+
+private:
+	std::unordered_map<string, shared_ptr<const CustomProviderSpec>> providers_;
+	std::mutex mutex_;
+};
+
+struct CustomProviderFunctions {
+public:
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
@@ -0,0 +1,101 @@
+#include "dns_cache.hpp"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
+namespace sudan {
+
+std::string DnsCache::Resolve(const std::string &host, uint64_t ttl_seconds) {
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto &slot = entries_[host];
+		if (!slot) {
+			slot = std::make_shared<Entry>();
+		}
+		entry = slot;
+	}
+
+	// Held across the lookup, so a burst of connections to a cold host waits for the first one's result
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	auto now = std::chrono::steady_clock::now();
+	if (!entry->address.empty() && now < entry->expires_at) {
+		return entry->address;
+	}
+	auto addresses = Lookup(host);
+	if (addresses.empty()) {
+		return std::string();
+	}
+	entry->address = addresses[0];
+	for (auto &address : addresses) {
+		if (address != entry->failed_address) {
+			entry->address = address;
+			break;
+		}
+	}
+	entry->expires_at = now + std::chrono::seconds(ttl_seconds);
+	return entry->address;
+}
+
+void DnsCache::Invalidate(const std::string &host, const std::string &address) {
+	std::shared_ptr<Entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = entries_.find(host);
+		if (it == entries_.end()) {
+			return;
+		}
+		entry = it->second;
+	}
+	std::lock_guard<std::mutex> lock(entry->mutex);
+	// Connections of a burst fail together: only the first one drops the address, the others must not drop the
+	// address resolved since
+	if (!address.empty() && entry->address == address) {
+		entry->failed_address = address;
+		entry->address.clear();
+	}
+}
+
+std::vector<std::string> DnsCache::Lookup(const std::string &host) {
+	struct addrinfo hints = {};
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	std::vector<std::string> addresses;
+	struct addrinfo *result = nullptr;
+	if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+		return addresses;
+	}
+
+	// The resolver already sorted the addresses by preference (RFC 6724)
+	for (auto info = result; info; info = info->ai_next) {
+		char buffer[INET6_ADDRSTRLEN] = {};
+		const char *address = nullptr;
+		if (info->ai_family == AF_INET) {
+			auto ipv4 = reinterpret_cast<struct sockaddr_in *>(info->ai_addr);
+			address = inet_ntop(AF_INET, &ipv4->sin_addr, buffer, sizeof(buffer));
+		} else if (info->ai_family == AF_INET6) {
+			auto ipv6 = reinterpret_cast<struct sockaddr_in6 *>(info->ai_addr);
+			address = inet_ntop(AF_INET6, &ipv6->sin6_addr, buffer, sizeof(buffer));
+		}
+		if (address) {
+			addresses.emplace_back(address);
+		}
+	}
+	freeaddrinfo(result);
+	return addresses;
+}
+
+DnsCache &DnsCache::Instance() {
+	static DnsCache instance;
+	return instance;
+}
+
+} // namespace sudan
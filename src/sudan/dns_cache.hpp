@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sudan {
+
+//! Process-wide cache of resolved provider host names, shared by all connections like the response cache.
+//!
+//! Parallel connections to the same host wait for a single lookup instead of each querying the resolver.
+//! Addresses are kept for `ttl_seconds`; lookups that fail are not cached. A connect failure drops the address, and the
+//! next lookup prefers any other address of the host over the one that failed.
+class DnsCache {
+public:
+	//! Numeric address of the host, resolved at most once per ttl_seconds. Empty if the host does not resolve.
+	std::string Resolve(const std::string &host, uint64_t ttl_seconds);
+
+	//! Forget the address of a host after a connection to it failed, unless it was already replaced
+	void Invalidate(const std::string &host, const std::string &address);
+
+	static DnsCache &Instance();
+
+private:
+	struct Entry {
+		std::mutex mutex;
+		std::string address;
+		std::chrono::steady_clock::time_point expires_at;
+		//! Address dropped after a connect failure, only used again if the host resolves to nothing else
+		std::string failed_address;
+	};
+
+	//! Numeric addresses of the host in the resolver's order of preference
+	static std::vector<std::string> Lookup(const std::string &host);
+
+	std::unordered_map<std::string, std::shared_ptr<Entry>> entries_;
+	std::mutex mutex_;
+};
+
+} // namespace sudan
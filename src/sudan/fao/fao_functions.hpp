@@ -1,5 +1,8 @@
 #pragma once
 
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+
 namespace duckdb {
 
 class ExtensionLoader;
@@ -7,6 +10,14 @@ class ExtensionLoader;
 struct FAOFunctions {
 public:
 	static void Register(ExtensionLoader &loader);
+
+	//! Create a SUDAN_FAO scan over a single dataset (used by the ATTACH catalog)
+	static TableFunction GetCatalogScan(const string &dataset, const vector<string> &countries,
+	                                    vector<LogicalType> &return_types, vector<string> &names,
+	                                    unique_ptr<FunctionData> &bind_data);
+
+	//! Whether a dataset (FAOSTAT domain code) exists, from the cached list of domains
+	static bool DatasetExists(ClientContext &context, const string &dataset);
 };
 
 } // namespace duckdb
@@ -3,8 +3,13 @@
 
 namespace sudan {
 
+// Bounds of 0 and below mean "no bound": a filter without a positive one adds nothing to the request
+static bool HasYearBounds(const FilterResult &filter) {
+	return filter.has_year_filter && (filter.year_start > 0 || filter.year_end > 0);
+}
+
 std::string EncodeWorldBankYearFilter(const FilterResult &filter) {
-	if (!filter.has_year_filter) {
+	if (!HasYearBounds(filter)) {
 		return "";
 	}
 	std::ostringstream ss;
@@ -19,12 +24,11 @@ std::string EncodeWorldBankYearFilter(const FilterResult &filter) {
 	return ss.str();
 }
 
-std::string EncodeWHOYearFilter(const FilterResult &filter) {
-	if (!filter.has_year_filter) {
+std::string EncodeWHOYearClause(const FilterResult &filter) {
+	if (!HasYearBounds(filter)) {
 		return "";
 	}
 	std::ostringstream ss;
-	ss << "$filter=";
 	bool need_and = false;
 	if (filter.year_start > 0) {
 		ss << "TimeDim ge " << filter.year_start;
@@ -39,8 +43,16 @@ std::string EncodeWHOYearFilter(const FilterResult &filter) {
 	return ss.str();
 }
 
+std::string EncodeWHOYearFilter(const FilterResult &filter) {
+	auto clause = EncodeWHOYearClause(filter);
+	if (clause.empty()) {
+		return "";
+	}
+	return "$filter=" + clause;
+}
+
 std::string EncodeFAOYearFilter(const FilterResult &filter) {
-	if (!filter.has_year_filter) {
+	if (!HasYearBounds(filter)) {
 		return "";
 	}
 	std::ostringstream ss;
@@ -59,7 +71,7 @@ std::string EncodeFAOYearFilter(const FilterResult &filter) {
 }
 
 std::string EncodeUNHCRYearFilter(const FilterResult &filter) {
-	if (!filter.has_year_filter) {
+	if (!HasYearBounds(filter)) {
 		return "";
 	}
 	std::ostringstream ss;
@@ -78,7 +90,7 @@ std::string EncodeUNHCRYearFilter(const FilterResult &filter) {
 }
 
 std::string EncodeILOYearFilter(const FilterResult &filter) {
-	if (!filter.has_year_filter) {
+	if (!HasYearBounds(filter)) {
 		return "";
 	}
 	std::ostringstream ss;
@@ -9,14 +9,24 @@ namespace sudan {
 //! Filter pushdown result for a provider query
 struct FilterResult {
 	bool has_year_filter = false;
+	//! Inclusive bounds, 0 or below when unbounded
 	int32_t year_start = -1;
 	int32_t year_end = -1;
+
+	//! Whether the bounds contradict each other (e.g. year > 2020 AND year < 2010), so no row can match
+	bool IsEmpty() const {
+		return has_year_filter && year_start > 0 && year_end > 0 && year_start > year_end;
+	}
 };
 
 //! Encode year range filter as World Bank API parameter
-//! Returns e.g. "date=2010:2023"
+//! Returns e.g. "date=2010:2023". Like all encoders, returns "" when neither bound is positive.
 std::string EncodeWorldBankYearFilter(const FilterResult &filter);
 
+//! Encode year range filter as a WHO GHO OData filter clause, to be combined with other clauses
+//! Returns e.g. "TimeDim ge 2015 and TimeDim le 2023"
+std::string EncodeWHOYearClause(const FilterResult &filter);
+
 //! Encode year range filter as WHO GHO OData filter
 //! Returns e.g. "$filter=TimeDim ge 2015 and TimeDim le 2023"
 std::string EncodeWHOYearFilter(const FilterResult &filter);
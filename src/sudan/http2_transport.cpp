@@ -0,0 +1,241 @@
+#include "http2_transport.hpp"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace sudan {
+
+using std::chrono::steady_clock;
+
+//! A GET in flight: owned by the waiting caller, driven by the worker thread
+struct Http2Transport::Transfer {
+	CURL *easy = nullptr;
+	curl_slist *headers = nullptr;
+	Response response;
+
+	steady_clock::time_point first_byte_deadline;
+	steady_clock::time_point read_deadline = steady_clock::time_point::max();
+	steady_clock::time_point deadline;
+	uint64_t read_timeout = 0;
+	std::string budget_error;
+
+	bool done = false;
+};
+
+// Called once per header line, including the status line of every response in a redirect chain
+size_t Http2Transport::OnHeader(char *buffer, size_t size, size_t count, void *data) {
+	auto &transfer = *static_cast<Transfer *>(data);
+	auto length = size * count;
+	std::string line(buffer, length);
+	while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) {
+		line.pop_back();
+	}
+
+	if (line.compare(0, 5, "HTTP/") == 0) {
+		auto now = steady_clock::now();
+		if (now > transfer.first_byte_deadline) {
+			transfer.budget_error = "first byte budget exceeded (sudan_first_byte_timeout)";
+			return 0;
+		}
+		transfer.read_deadline = now + std::chrono::seconds(transfer.read_timeout);
+		transfer.response.headers.clear();
+		return length;
+	}
+
+	auto colon = line.find(':');
+	if (colon != std::string::npos) {
+		auto value_start = line.find_first_not_of(" \t", colon + 1);
+		transfer.response.headers.emplace_back(line.substr(0, colon), value_start == std::string::npos
+		                                                                  ? std::string()
+		                                                                  : line.substr(value_start));
+	}
+	return length;
+}
+
+size_t Http2Transport::OnBody(char *buffer, size_t size, size_t count, void *data) {
+	auto &transfer = *static_cast<Transfer *>(data);
+	auto now = steady_clock::now();
+	if (now > transfer.read_deadline) {
+		transfer.budget_error = "read budget exceeded (sudan_read_timeout)";
+		return 0;
+	}
+	if (now >= transfer.deadline) {
+		transfer.budget_error = "query deadline exceeded (sudan_query_timeout)";
+		return 0;
+	}
+	transfer.response.body.append(buffer, size * count);
+	return size * count;
+}
+
+Http2Transport::Http2Transport() : multi_(nullptr), shutdown_(false) {
+	curl_global_init(CURL_GLOBAL_DEFAULT);
+	auto multi = curl_multi_init();
+	// Streams to the same host share one connection (the default since curl 7.62, set for older versions)
+	curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+	multi_ = multi;
+	worker_ = std::thread([this]() { Run(); });
+}
+
+Http2Transport::~Http2Transport() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		shutdown_ = true;
+	}
+	curl_multi_wakeup(static_cast<CURLM *>(multi_));
+	worker_.join();
+	curl_multi_cleanup(static_cast<CURLM *>(multi_));
+}
+
+Http2Transport::Response Http2Transport::Get(const Request &request) {
+	Transfer transfer;
+	transfer.deadline = request.deadline;
+	transfer.read_timeout = request.read_timeout;
+	transfer.first_byte_deadline = steady_clock::now() + std::chrono::seconds(request.first_byte_timeout);
+
+	transfer.easy = curl_easy_init();
+	if (!transfer.easy) {
+		transfer.response.error = "HTTP request failed: could not create a transfer";
+		return std::move(transfer.response);
+	}
+	auto easy = transfer.easy;
+
+	curl_easy_setopt(easy, CURLOPT_URL, request.url.c_str());
+	curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+	// Wait for an existing connection to the host to confirm multiplexing instead of opening another one
+	curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+	curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+	curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, 0L);
+	curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, 0L);
+	curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, request.follow_redirects ? 1L : 0L);
+	curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, OnHeader);
+	curl_easy_setopt(easy, CURLOPT_HEADERDATA, &transfer);
+	curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, OnBody);
+	curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer);
+	curl_easy_setopt(easy, CURLOPT_PRIVATE, &transfer);
+
+	// No phase may outlast the deadline. A stalled stream is cut off like an httplib socket read timeout.
+	auto remaining_ms = std::numeric_limits<long>::max();
+	if (request.deadline != steady_clock::time_point::max()) {
+		auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(request.deadline - steady_clock::now());
+		remaining_ms = std::max<long>(static_cast<long>(remaining.count()), 1);
+		curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, remaining_ms);
+	}
+	auto connect_ms = std::min<long>(static_cast<long>(request.connect_timeout * 1000), remaining_ms);
+	curl_easy_setopt(easy, CURLOPT_CONNECTTIMEOUT_MS, connect_ms);
+	curl_easy_setopt(easy, CURLOPT_LOW_SPEED_LIMIT, 1L);
+	curl_easy_setopt(easy, CURLOPT_LOW_SPEED_TIME,
+	                 static_cast<long>(std::max(request.first_byte_timeout, request.read_timeout)));
+
+	if (!request.proxy.empty()) {
+		curl_easy_setopt(easy, CURLOPT_PROXY, request.proxy.c_str());
+		if (!request.proxy_credentials.empty()) {
+			curl_easy_setopt(easy, CURLOPT_PROXYUSERPWD, request.proxy_credentials.c_str());
+		}
+	}
+
+	for (auto &header : request.headers) {
+		auto line = header.first + ": " + header.second;
+		transfer.headers = curl_slist_append(transfer.headers, line.c_str());
+	}
+	curl_easy_setopt(easy, CURLOPT_HTTPHEADER, transfer.headers);
+
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		pending_.push_back(&transfer);
+		curl_multi_wakeup(static_cast<CURLM *>(multi_));
+		transfer_done_.wait(lock, [&]() { return transfer.done; });
+	}
+
+	curl_easy_cleanup(easy);
+	curl_slist_free_all(transfer.headers);
+	return std::move(transfer.response);
+}
+
+void Http2Transport::Run() {
+	auto multi = static_cast<CURLM *>(multi_);
+	std::vector<Transfer *> active;
+
+	auto complete = [&](Transfer *transfer, const std::string &error) {
+		curl_multi_remove_handle(multi, transfer->easy);
+		active.erase(std::find(active.begin(), active.end(), transfer));
+		transfer->response.error = error;
+		std::lock_guard<std::mutex> lock(mutex_);
+		transfer->done = true;
+	};
+
+	while (true) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (shutdown_) {
+				break;
+			}
+			for (auto transfer : pending_) {
+				if (curl_multi_add_handle(multi, transfer->easy) == CURLM_OK) {
+					active.push_back(transfer);
+				} else {
+					transfer->response.error = "HTTP request failed: could not start the transfer";
+					transfer->done = true;
+				}
+			}
+			pending_.clear();
+		}
+		transfer_done_.notify_all();
+
+		int running = 0;
+		curl_multi_perform(multi, &running);
+
+		CURLMsg *message;
+		int queued = 0;
+		bool completed = false;
+		while ((message = curl_multi_info_read(multi, &queued))) {
+			if (message->msg != CURLMSG_DONE) {
+				continue;
+			}
+			char *data = nullptr;
+			curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &data);
+			auto transfer = reinterpret_cast<Transfer *>(data);
+			auto result = message->data.result;
+
+			std::string error;
+			if (result == CURLE_OK) {
+				long status_code = 0;
+				curl_easy_getinfo(transfer->easy, CURLINFO_RESPONSE_CODE, &status_code);
+				transfer->response.status_code = static_cast<int32_t>(status_code);
+			} else {
+				error = "HTTP request failed: " +
+				        (transfer->budget_error.empty() ? std::string(curl_easy_strerror(result)) : transfer->budget_error);
+			}
+			complete(transfer, error);
+			completed = true;
+		}
+		if (completed) {
+			transfer_done_.notify_all();
+		}
+
+		// Returns early when a socket is ready or Get() submits a transfer
+		curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+	}
+
+	// Nobody may be left waiting
+	std::lock_guard<std::mutex> lock(mutex_);
+	for (auto transfer : pending_) {
+		transfer->response.error = "HTTP request failed: transport shut down";
+		transfer->done = true;
+	}
+	pending_.clear();
+	for (auto transfer : active) {
+		curl_multi_remove_handle(multi, transfer->easy);
+		transfer->response.error = "HTTP request failed: transport shut down";
+		transfer->done = true;
+	}
+	transfer_done_.notify_all();
+}
+
+Http2Transport &Http2Transport::Instance() {
+	static Http2Transport instance;
+	return instance;
+}
+
+} // namespace sudan
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace sudan {
+
+//! HTTP/2 transport for GET requests, shared by all connections like the response cache.
+//!
+//! A single libcurl multi handle, driven by one background thread, multiplexes every concurrent request to a host as
+//! streams of one connection instead of opening a socket (and TLS handshake) per request. Hosts that only speak
+//! HTTP/1.1 still work, with one request per connection.
+class Http2Transport {
+public:
+	struct Request {
+		std::string url;
+		std::vector<std::pair<std::string, std::string>> headers;
+		std::string proxy;
+		//! "user:password", empty without proxy authentication
+		std::string proxy_credentials;
+		bool follow_redirects = true;
+		//! Per-phase budgets in seconds, measured from when the request is sent
+		uint64_t connect_timeout = 0;
+		uint64_t first_byte_timeout = 0;
+		uint64_t read_timeout = 0;
+		//! No phase may outlast the deadline
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+	};
+
+	struct Response {
+		int32_t status_code = 0;
+		//! Headers of the final response, after redirects
+		std::vector<std::pair<std::string, std::string>> headers;
+		std::string body;
+		//! Non-empty if the request failed
+		std::string error;
+	};
+
+	//! Send a GET and wait for its response
+	Response Get(const Request &request);
+
+	static Http2Transport &Instance();
+
+	~Http2Transport();
+
+private:
+	struct Transfer;
+
+	Http2Transport();
+
+	//! Add submitted transfers to the multi handle, drive them and complete the finished ones, until shutdown
+	void Run();
+
+	//! libcurl callbacks, enforcing the first-byte and read budgets
+	static size_t OnHeader(char *buffer, size_t size, size_t count, void *data);
+	static size_t OnBody(char *buffer, size_t size, size_t count, void *data);
+
+	void *multi_;
+	std::thread worker_;
+	std::mutex mutex_;
+	std::condition_variable transfer_done_;
+	//! Submitted transfers not yet added to the multi handle
+	std::vector<Transfer *> pending_;
+	bool shutdown_;
+};
+
+} // namespace sudan
@@ -7,6 +7,18 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_context_file_opener.hpp"
 
+// SUDAN
+#include "sudan/circuit_breaker.hpp"
+#include "sudan/dns_cache.hpp"
+#ifdef SUDAN_ENABLE_HTTP2
+#include "sudan/http2_transport.hpp"
+#endif
+#include "sudan/latency_tracker.hpp"
+#include "sudan/query_budget.hpp"
+
+#include <condition_variable>
+#include <thread>
+
 namespace duckdb {
 
 //======================================================================================================================
@@ -35,25 +47,6 @@ static void ParseUrl(const string &url, string &proto_host_port, string &path) {
 	}
 }
 
-// Normalize HTTP header name to Title-Case
-static string NormalizeHeaderName(const string &name) {
-	string result;
-	result.reserve(name.size());
-	bool capitalize_next = true;
-	for (char c : name) {
-		if (c == '-') {
-			result += c;
-			capitalize_next = true;
-		} else if (capitalize_next) {
-			result += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-			capitalize_next = false;
-		} else {
-			result += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-		}
-	}
-	return result;
-}
-
 //======================================================================================================================
 // HttpClient Implementation
 //======================================================================================================================
@@ -81,6 +74,59 @@ HttpSettings HttpClient::ExtractHttpSettings(ClientContext &context, const strin
 	FileOpener::TryGetCurrentSetting(&opener, "http_request_cache", settings.use_cache, &info);
 	FileOpener::TryGetCurrentSetting(&opener, "http_follow_redirects", settings.follow_redirects, &info);
 
+	// Per-phase budgets fall back to http_timeout
+	settings.connect_timeout = 0;
+	settings.first_byte_timeout = 0;
+	settings.read_timeout = 0;
+	settings.query_timeout = 0;
+	settings.partial_results = false;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_connect_timeout", settings.connect_timeout, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_first_byte_timeout", settings.first_byte_timeout, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_read_timeout", settings.read_timeout, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_query_timeout", settings.query_timeout, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_partial_results", settings.partial_results, &info);
+
+	settings.hedge_requests = false;
+	settings.hedge_budget = 5.0;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_hedge_requests", settings.hedge_requests, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_hedge_budget", settings.hedge_budget, &info);
+
+	settings.breaker_threshold = 5;
+	settings.breaker_cooldown = 30;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_breaker_threshold", settings.breaker_threshold, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_breaker_cooldown", settings.breaker_cooldown, &info);
+	for (auto budget : {&settings.connect_timeout, &settings.first_byte_timeout, &settings.read_timeout}) {
+		if (*budget == 0) {
+			*budget = settings.timeout;
+		}
+	}
+
+	settings.http2 = false;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_http2", settings.http2, &info);
+
+	settings.dns_cache_ttl = 300;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_dns_cache_ttl", settings.dns_cache_ttl, &info);
+
+	settings.negative_cache_ttl = 60;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_negative_cache_ttl", settings.negative_cache_ttl, &info);
+
+	// Validated when set, see QueryBudget::Register. Each connection is its own session for fair queuing.
+	string priority;
+	if (FileOpener::TryGetCurrentSetting(&opener, "sudan_priority", priority, &info)) {
+		sudan::RequestScheduler::ParsePriority(priority, settings.request_ticket.priority);
+	}
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_session_weight", settings.request_ticket.weight, &info);
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_session_quota", settings.request_ticket.quota, &info);
+	settings.host_concurrency = 16;
+	FileOpener::TryGetCurrentSetting(&opener, "sudan_host_concurrency", settings.host_concurrency, &info);
+
+	settings.query_state = SudanQueryState::Get(context);
+	settings.request_ticket.session = settings.query_state->SessionId();
+	settings.deadline = std::chrono::steady_clock::time_point::max();
+	if (settings.query_timeout > 0) {
+		settings.deadline = settings.query_state->QueryStart() + std::chrono::seconds(settings.query_timeout);
+	}
+
 	settings.proxy = config.options.http_proxy;
 	settings.proxy_username = config.options.http_proxy_username;
 	settings.proxy_password = config.options.http_proxy_password;
@@ -105,102 +151,619 @@ HttpSettings HttpClient::ExtractHttpSettings(ClientContext &context, const strin
 	return settings;
 }
 
-// Execute HTTP request with given settings
-HttpResponseData HttpClient::ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
-                                                const duckdb_httplib_openssl::Headers &headers,
-                                                const string &request_body, const string &content_type) {
+//======================================================================================================================
+// Request Execution
+//======================================================================================================================
 
-	HttpResponseData result;
-	result.status_code = 0;
-	result.content_length = -1;
+using duckdb_httplib_openssl::Client;
+using std::chrono::steady_clock;
 
-	try {
-		string proto_host_port, path;
-		ParseUrl(url, proto_host_port, path);
+// Idle kept-alive clients kept per host, and how long before they are dropped
+static constexpr idx_t MAX_IDLE_CLIENTS_PER_HOST = 8;
+static constexpr int64_t CLIENT_IDLE_TIMEOUT_SECONDS = 30;
 
-		duckdb_httplib_openssl::Client client(proto_host_port);
-		client.set_follow_location(settings.follow_redirects);
-		client.set_decompress(false);
-		client.enable_server_certificate_verification(false);
+// Host name of a "scheme://host[:port]" prefix, empty for IPv6 literals which need no lookup
+static string HostName(const string &proto_host_port) {
+	auto host_start = proto_host_port.find("://");
+	host_start = host_start == string::npos ? 0 : host_start + 3;
+	if (host_start < proto_host_port.size() && proto_host_port[host_start] == '[') {
+		return string();
+	}
+	auto host_end = proto_host_port.find(':', host_start);
+	return proto_host_port.substr(host_start, host_end == string::npos ? string::npos : host_end - host_start);
+}
 
-		auto timeout_sec = static_cast<time_t>(settings.timeout);
-		client.set_read_timeout(timeout_sec, 0);
-		client.set_write_timeout(timeout_sec, 0);
-		client.set_connection_timeout(timeout_sec, 0);
-		client.set_keep_alive(settings.keep_alive);
+// Apply the settings of a request to a new or pooled client, with every timeout clamped to the query deadline
+static void ConfigureClient(const HttpSettings &settings, Client &client) {
+	client.set_follow_location(settings.follow_redirects);
+	client.set_decompress(false);
+	client.enable_server_certificate_verification(false);
+
+	// No phase may outlast the query deadline
+	auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(settings.deadline - steady_clock::now());
+	auto budget = [&](uint64_t seconds) {
+		auto phase = std::chrono::microseconds(std::chrono::seconds(seconds));
+		return MaxValue<int64_t>(MinValue<int64_t>(phase.count(), remaining.count()), 0);
+	};
+
+	// Socket reads wait for the headers first, then for each body packet
+	auto connect_usec = budget(settings.connect_timeout);
+	auto socket_usec = budget(MaxValue(settings.first_byte_timeout, settings.read_timeout));
+	client.set_connection_timeout(static_cast<time_t>(connect_usec / 1000000),
+	                              static_cast<time_t>(connect_usec % 1000000));
+	client.set_read_timeout(static_cast<time_t>(socket_usec / 1000000), static_cast<time_t>(socket_usec % 1000000));
+	client.set_write_timeout(static_cast<time_t>(socket_usec / 1000000), static_cast<time_t>(socket_usec % 1000000));
+	client.set_keep_alive(settings.keep_alive);
+
+	if (!settings.proxy.empty()) {
+		string proxy_host;
+		idx_t proxy_port = 80;
+		string proxy_copy = settings.proxy;
+		HTTPUtil::ParseHTTPProxyHost(proxy_copy, proxy_host, proxy_port);
+		client.set_proxy(proxy_host, static_cast<int>(proxy_port));
+		if (!settings.proxy_username.empty()) {
+			client.set_proxy_basic_auth(settings.proxy_username, settings.proxy_password);
+		}
+	}
+}
 
-		if (!settings.proxy.empty()) {
-			string proxy_host;
-			idx_t proxy_port = 80;
-			string proxy_copy = settings.proxy;
-			HTTPUtil::ParseHTTPProxyHost(proxy_copy, proxy_host, proxy_port);
-			client.set_proxy(proxy_host, static_cast<int>(proxy_port));
-			if (!settings.proxy_username.empty()) {
-				client.set_proxy_basic_auth(settings.proxy_username, settings.proxy_password);
+// Create a client on a new connection. Sets address to the cached address it connects to, if any.
+static shared_ptr<Client> CreateClient(const HttpSettings &settings, const string &proto_host_port,
+                                       string *address = nullptr) {
+	auto client = make_shared_ptr<Client>(proto_host_port);
+
+	// Connect to the cached address; TLS still sends SNI and the Host header for the host name (certificates are not
+	// verified, see ConfigureClient). Through a proxy, the proxy resolves the host.
+	auto host = HostName(proto_host_port);
+	if (settings.dns_cache_ttl > 0 && settings.proxy.empty() && !host.empty()) {
+		auto cached_address = sudan::DnsCache::Instance().Resolve(host, settings.dns_cache_ttl);
+		if (!cached_address.empty()) {
+			client->set_hostname_addr_map({{host, cached_address}});
+			if (address) {
+				*address = cached_address;
 			}
 		}
+	}
 
-		duckdb_httplib_openssl::Headers req_headers = headers;
-		if (req_headers.find("User-Agent") == req_headers.end()) {
-			req_headers.insert({"User-Agent", settings.user_agent});
+	ConfigureClient(settings, *client);
+	return client;
+}
+
+// A connection to the cached address failed: the next one resolves the host again, preferring another address
+static void ForgetAddress(const string &proto_host_port, const string &address) {
+	if (!address.empty()) {
+		sudan::DnsCache::Instance().Invalidate(HostName(proto_host_port), address);
+	}
+}
+
+//! Idle kept-alive clients, shared by all connections like the response cache. A reused client sends its request on
+//! an established connection, skipping the DNS lookup, TCP connect and TLS handshake.
+class ClientPool {
+public:
+	shared_ptr<Client> Acquire(const string &key) {
+		lock_guard<mutex> guard(lock);
+		auto entry = idle.find(key);
+		if (entry == idle.end()) {
+			return nullptr;
+		}
+		// Most recently used first, its connection is the most likely to still be open
+		auto &clients = entry->second;
+		auto now = steady_clock::now();
+		while (!clients.empty()) {
+			auto client = std::move(clients.back());
+			clients.pop_back();
+			if (now - client.second < std::chrono::seconds(CLIENT_IDLE_TIMEOUT_SECONDS)) {
+				return std::move(client.first);
+			}
+		}
+		return nullptr;
+	}
+
+	void Release(const string &key, shared_ptr<Client> client) {
+		lock_guard<mutex> guard(lock);
+		auto &clients = idle[key];
+		if (clients.size() >= MAX_IDLE_CLIENTS_PER_HOST) {
+			clients.erase(clients.begin());
 		}
+		clients.emplace_back(std::move(client), steady_clock::now());
+	}
+
+	static ClientPool &Instance() {
+		static ClientPool instance;
+		return instance;
+	}
+
+private:
+	mutex lock;
+	//! (client, idle since) per host and proxy, oldest first
+	unordered_map<string, vector<pair<shared_ptr<Client>, steady_clock::time_point>>> idle;
+};
+
+// Connections through different proxies are not interchangeable
+static string ClientPoolKey(const HttpSettings &settings, const string &proto_host_port) {
+	return proto_host_port + " " + settings.proxy + " " + settings.proxy_username;
+}
 
+//======================================================================================================================
+// RequestCancellation
+//======================================================================================================================
+
+void RequestCancellation::Cancel() {
+	{
+		lock_guard<mutex> guard(lock);
+		cancelled = true;
+		for (auto &client : clients) {
+			client->stop();
+		}
+	}
+	// Requests still queued for a slot stop waiting
+	sudan::RequestScheduler::Instance().WakeWaiters();
+}
+
+bool RequestCancellation::IsCancelled() const {
+	return cancelled;
+}
+
+bool RequestCancellation::Track(const shared_ptr<Client> &client) {
+	lock_guard<mutex> guard(lock);
+	if (cancelled) {
+		return false;
+	}
+	clients.push_back(client);
+	return true;
+}
+
+void RequestCancellation::Untrack(const Client &client) {
+	lock_guard<mutex> guard(lock);
+	for (auto it = clients.begin(); it != clients.end(); ++it) {
+		if (it->get() == &client) {
+			clients.erase(it);
+			return;
+		}
+	}
+}
+
+// Keeps the client of a request stoppable by its scan's cancellation while the request runs
+class TrackedRequest {
+public:
+	TrackedRequest(const HttpSettings &settings, const shared_ptr<Client> &client)
+	    : cancellation(settings.cancellation), client(client) {
+		tracked = !cancellation || cancellation->Track(client);
+	}
+
+	~TrackedRequest() {
+		if (cancellation && tracked) {
+			cancellation->Untrack(*client);
+		}
+	}
+
+	//! The scan was cancelled before the request was sent: do not send it
+	bool Cancelled() const {
+		return !tracked;
+	}
+
+private:
+	shared_ptr<RequestCancellation> cancellation;
+	shared_ptr<Client> client;
+	bool tracked;
+};
+
+static constexpr const char *CANCELLED_ERROR = "HTTP request cancelled: the scan ended";
+
+// Keep the raw headers of a response, reading only its content type and length
+template <class HEADERS>
+static void SetResponseHeaders(HttpResponseData &result, HEADERS &headers) {
+	result.headers.reserve(headers.size());
+	for (auto &header : headers) {
+		if (StringUtil::CIEquals(header.first, "Content-Type")) {
+			result.content_type = header.second;
+		} else if (StringUtil::CIEquals(header.first, "Content-Length")) {
+			try {
+				result.content_length = std::stoll(header.second);
+			} catch (...) {
+			}
+		}
+		result.headers.emplace_back(header.first, std::move(header.second));
+	}
+}
+
+// Set the body of a response, decompressing gzip
+static void SetResponseBody(HttpResponseData &result, string &&response_body) {
+	try {
+		if (GZipFileSystem::CheckIsZip(response_body.data(), response_body.size())) {
+			result.body = GZipFileSystem::UncompressGZIPString(response_body);
+			return;
+		}
+	} catch (...) {
+	}
+	result.body = std::move(response_body);
+}
+
+// Send one attempt of a request. Client::stop() from another thread aborts it.
+static HttpResponseData SendRequest(const HttpSettings &settings, Client &client, const string &path,
+                                    const string &method, const duckdb_httplib_openssl::Headers &headers,
+                                    const string &request_body, const string &content_type,
+                                    const HttpBodyReceiver &receiver = HttpBodyReceiver()) {
+	HttpResponseData result;
+	result.status_code = 0;
+	result.content_length = -1;
+
+	try {
 		duckdb_httplib_openssl::Result res(nullptr, duckdb_httplib_openssl::Error::Unknown);
 
-		if (StringUtil::CIEquals(method, "GET")) {
-			res = client.Get(path, req_headers);
-		} else if (StringUtil::CIEquals(method, "POST")) {
+		// GET bodies are received incrementally so the first-byte and read budgets are enforced per phase
+		string response_body;
+		string budget_error;
+		auto first_byte_deadline = steady_clock::now() + std::chrono::seconds(settings.first_byte_timeout);
+		auto read_deadline = steady_clock::time_point::max();
+		// A successful body goes to the receiver as it arrives, anything else is buffered as usual
+		bool streaming = false;
+		bool streamed = false;
+		auto on_response = [&](const duckdb_httplib_openssl::Response &response) {
+			auto now = steady_clock::now();
+			if (now > first_byte_deadline) {
+				budget_error = "first byte budget exceeded (sudan_first_byte_timeout)";
+				return false;
+			}
+			read_deadline = now + std::chrono::seconds(settings.read_timeout);
+			streaming = receiver && response.status == 200;
+			return true;
+		};
+		auto on_content = [&](const char *data, size_t data_length) {
+			auto now = steady_clock::now();
+			if (now > read_deadline) {
+				budget_error = "read budget exceeded (sudan_read_timeout)";
+				return false;
+			}
+			if (now >= settings.deadline) {
+				budget_error = "query deadline exceeded (sudan_query_timeout)";
+				return false;
+			}
+			// A gzip body cannot be consumed incrementally, it is buffered and decompressed at the end
+			if (streaming && !streamed && data_length >= 2 &&
+			    GZipFileSystem::CheckIsZip(data, data_length)) {
+				streaming = false;
+			}
+			if (streaming) {
+				streamed = true;
+				if (!receiver(data, data_length)) {
+					budget_error = "malformed response body";
+					return false;
+				}
+				return true;
+			}
+			response_body.append(data, data_length);
+			return true;
+		};
+
+		if (StringUtil::CIEquals(method, "POST")) {
 			string ct = content_type.empty() ? "application/octet-stream" : content_type;
-			res = client.Post(path, req_headers, request_body, ct);
+			res = client.Post(path, headers, request_body, ct);
 		} else {
-			res = client.Get(path, req_headers);
+			res = client.Get(path, headers, on_response, on_content);
 		}
 
 		if (res.error() != duckdb_httplib_openssl::Error::Success) {
-			result.error = "HTTP request failed: " + to_string(res.error());
+			result.error = "HTTP request failed: " + (budget_error.empty() ? to_string(res.error()) : budget_error);
+			result.connect_failed = res.error() == duckdb_httplib_openssl::Error::Connection;
 			return result;
 		}
 
 		result.status_code = res->status;
-		string response_body = res->body;
-
-		for (auto &header : res->headers) {
-			string normalized_key = NormalizeHeaderName(header.first);
-			if (StringUtil::CIEquals(header.first, "Content-Type")) {
-				result.content_type = header.second;
-			} else if (StringUtil::CIEquals(header.first, "Content-Length")) {
-				try {
-					result.content_length = std::stoll(header.second);
-				} catch (...) {
-				}
-			}
-			bool found = false;
-			for (idx_t i = 0; i < result.header_keys.size(); i++) {
-				if (StringUtil::CIEquals(result.header_keys[i].GetValue<string>(), normalized_key)) {
-					result.header_values[i] = Value(header.second);
-					found = true;
-					break;
-				}
+		if (response_body.empty()) {
+			response_body = std::move(res->body);
+		}
+
+		SetResponseHeaders(result, res->headers);
+		SetResponseBody(result, std::move(response_body));
+		if (receiver && result.status_code == 200 && !streamed && !result.body.empty()) {
+			if (!receiver(result.body.data(), result.body.size())) {
+				result.error = "HTTP request failed: malformed response body";
 			}
-			if (!found) {
-				result.header_keys.push_back(Value(normalized_key));
-				result.header_values.push_back(Value(header.second));
+			result.body.clear();
+		}
+
+	} catch (std::exception &e) {
+		result.error = e.what();
+	}
+
+	return result;
+}
+
+#ifdef SUDAN_ENABLE_HTTP2
+// Send a GET over the shared HTTP/2 transport, multiplexed with the other requests to the host
+static HttpResponseData SendHttp2(const HttpSettings &settings, const string &url,
+                                  const duckdb_httplib_openssl::Headers &headers) {
+	HttpResponseData result;
+	result.status_code = 0;
+	result.content_length = -1;
+
+	sudan::Http2Transport::Request request;
+	request.url = url;
+	request.headers.assign(headers.begin(), headers.end());
+	request.follow_redirects = settings.follow_redirects;
+	request.connect_timeout = settings.connect_timeout;
+	request.first_byte_timeout = settings.first_byte_timeout;
+	request.read_timeout = settings.read_timeout;
+	request.deadline = settings.deadline;
+	request.proxy = settings.proxy;
+	if (!settings.proxy_username.empty()) {
+		request.proxy_credentials = settings.proxy_username + ":" + settings.proxy_password;
+	}
+
+	auto response = sudan::Http2Transport::Instance().Get(request);
+	if (!response.error.empty()) {
+		result.error = response.error;
+		return result;
+	}
+	result.status_code = response.status_code;
+	SetResponseHeaders(result, response.headers);
+	SetResponseBody(result, std::move(response.body));
+	return result;
+}
+#endif
+
+static bool IsSuccess(const HttpResponseData &response) {
+	return response.status_code > 0 && !response.IsHostFailure();
+}
+
+//! Attempts of a hedged request, shared with the attempt threads
+struct HedgeRace {
+	mutex lock;
+	std::condition_variable attempt_done;
+	vector<shared_ptr<Client>> clients;
+	//! (attempt index, response) in completion order
+	vector<pair<idx_t, HttpResponseData>> responses;
+};
+
+//! Threads of the attempts of a hedged request, joined when it returns (or throws) so none outlives the request
+struct HedgeAttempts {
+	vector<std::thread> threads;
+
+	~HedgeAttempts() {
+		for (auto &thread : threads) {
+			if (thread.joinable()) {
+				thread.join();
 			}
 		}
+	}
+};
+
+// Send a GET and, if it is still running after the host's p95 latency, a duplicate on a second connection. The first
+// successful response wins and the other attempt is cancelled. The first attempt uses a pooled connection, returned to
+// the pool if it wins; only the duplicate pays for a new one.
+static HttpResponseData SendHedged(const HttpSettings &settings, const string &proto_host_port, const string &path,
+                                   const duckdb_httplib_openssl::Headers &headers) {
+	auto &tracker = sudan::HostLatencyTracker::Instance();
+	auto hedge_delay = tracker.HedgeDelay(proto_host_port);
+
+	auto race = make_shared_ptr<HedgeRace>();
+	// Declared before the lock, so the threads are joined after it is released
+	HedgeAttempts attempts;
+	unique_lock<mutex> guard(race->lock);
+
+	// Attempts stay stoppable by the scan's cancellation until the race is decided
+	vector<unique_ptr<TrackedRequest>> tracked;
+	auto &pool = ClientPool::Instance();
+	auto pool_key = ClientPoolKey(settings, proto_host_port);
+	auto launch = [&]() {
+		auto attempt = race->clients.size();
+		shared_ptr<Client> client;
+		string address;
+		if (attempt == 0 && settings.keep_alive) {
+			client = pool.Acquire(pool_key);
+		}
+		if (client) {
+			ConfigureClient(settings, *client);
+		} else {
+			client = CreateClient(settings, proto_host_port, &address);
+		}
+		tracked.push_back(make_uniq<TrackedRequest>(settings, client));
+		if (tracked.back()->Cancelled()) {
+			return false;
+		}
+		race->clients.push_back(client);
+		attempts.threads.emplace_back([race, client, address, attempt, settings, proto_host_port, path, headers]() {
+			auto start = steady_clock::now();
+			auto response = SendRequest(settings, *client, path, "GET", headers, "", "");
+			if (response.connect_failed) {
+				ForgetAddress(proto_host_port, address);
+			}
+			if (IsSuccess(response)) {
+				auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+				sudan::HostLatencyTracker::Instance().Record(proto_host_port, latency.count());
+			}
+			lock_guard<mutex> attempt_guard(race->lock);
+			race->responses.emplace_back(attempt, std::move(response));
+			race->attempt_done.notify_all();
+		});
+		return true;
+	};
+
+	if (!launch()) {
+		HttpResponseData result;
+		result.status_code = 0;
+		result.content_length = -1;
+		result.error = CANCELLED_ERROR;
+		return result;
+	}
+	if (hedge_delay > 0 &&
+	    !race->attempt_done.wait_for(guard, std::chrono::milliseconds(hedge_delay),
+	                                 [&]() { return !race->responses.empty(); }) &&
+	    tracker.TryHedge(proto_host_port, settings.hedge_budget)) {
+		launch();
+	}
 
-		// Auto-decompress gzip
-		result.body = response_body;
-		try {
-			if (GZipFileSystem::CheckIsZip(response_body.data(), response_body.size())) {
-				result.body = GZipFileSystem::UncompressGZIPString(response_body);
+	// Wait for the first success, or for every attempt to fail
+	race->attempt_done.wait(guard, [&]() {
+		if (race->responses.size() == race->clients.size()) {
+			return true;
+		}
+		for (auto &response : race->responses) {
+			if (IsSuccess(response.second)) {
+				return true;
 			}
-		} catch (...) {
 		}
+		return false;
+	});
+
+	auto winner = race->responses.begin();
+	for (auto it = race->responses.begin(); it != race->responses.end(); ++it) {
+		if (IsSuccess(it->second)) {
+			winner = it;
+			break;
+		}
+	}
+	if (winner->first > 0 && IsSuccess(winner->second)) {
+		tracker.RecordHedgeWin(proto_host_port);
+	}
+
+	// Cancel the loser, its thread is joined on return. A first attempt that won cleanly has finished its
+	// response, so its connection can serve the next request.
+	auto winner_attempt = winner->first;
+	auto result = std::move(winner->second);
+	for (idx_t attempt = 0; attempt < race->clients.size(); attempt++) {
+		if (attempt == winner_attempt && attempt == 0 && settings.keep_alive && result.error.empty()) {
+			pool.Release(pool_key, race->clients[attempt]);
+			continue;
+		}
+		race->clients[attempt]->stop();
+	}
+	return result;
+}
+
+// Execute HTTP request with given settings
+HttpResponseData HttpClient::ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
+                                                const duckdb_httplib_openssl::Headers &headers,
+                                                const string &request_body, const string &content_type,
+                                                const HttpBodyReceiver &receiver) {
+
+	HttpResponseData result;
+	result.status_code = 0;
+	result.content_length = -1;
+
+	if (settings.DeadlineExpired()) {
+		result.error = "Query deadline exceeded (sudan_query_timeout)";
+		return result;
+	}
+	if (settings.Cancelled()) {
+		result.error = CANCELLED_ERROR;
+		return result;
+	}
+
+	string proto_host_port, path;
+	try {
+		ParseUrl(url, proto_host_port, path);
+	} catch (std::exception &e) {
+		result.error = e.what();
+		return result;
+	}
+
+	// Interactive requests go first, background requests queue behind them and back off when they slow down.
+	// Connections share each class fairly, within their quotas.
+	auto &scheduler = sudan::RequestScheduler::Instance();
+	auto scheduled = settings.host_concurrency > 0;
+	if (scheduled && !scheduler.Acquire(proto_host_port, settings.request_ticket, settings.host_concurrency,
+	                                    settings.deadline,
+	                                    settings.cancellation ? &settings.cancellation->Flag() : nullptr)) {
+		if (settings.Cancelled()) {
+			result.error = CANCELLED_ERROR;
+		} else {
+			result.error = "Query deadline exceeded (sudan_query_timeout) while waiting for a request slot to " +
+			               proto_host_port;
+		}
+		return result;
+	}
+	auto request_start = steady_clock::now();
+
+	// An unreachable host fails fast instead of waiting out the timeouts of every request
+	auto &breaker = sudan::CircuitBreaker::Instance();
+	if (!breaker.AllowRequest(proto_host_port, settings.breaker_cooldown)) {
+		if (scheduled) {
+			scheduler.Release(proto_host_port, settings.request_ticket, 0);
+		}
+		result.error = "Circuit breaker open for " + proto_host_port + " after repeated failures";
+		result.circuit_open = true;
+		return result;
+	}
 
+	try {
+		duckdb_httplib_openssl::Headers req_headers = headers;
+		if (req_headers.find("User-Agent") == req_headers.end()) {
+			req_headers.insert({"User-Agent", settings.user_agent});
+		}
+
+		// Only idempotent requests are hedged. Over HTTP/2 a duplicate would share the slow request's connection.
+		// Streamed bodies are parsed on the requesting thread, so they stay on a connection of their own and are
+		// never raced against a duplicate.
+		auto is_get = !StringUtil::CIEquals(method, "POST");
+		if (settings.http2 && is_get && !receiver) {
+#ifdef SUDAN_ENABLE_HTTP2
+			auto start = steady_clock::now();
+			result = SendHttp2(settings, url, req_headers);
+			if (IsSuccess(result)) {
+				auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+				sudan::HostLatencyTracker::Instance().Record(proto_host_port, latency.count());
+			}
+#else
+			// Unreachable: SET sudan_http2 = true is rejected without the transport
+			result.error = "HTTP/2 transport not built (SUDAN_ENABLE_HTTP2)";
+#endif
+		} else if (settings.hedge_requests && is_get && !receiver) {
+			result = SendHedged(settings, proto_host_port, path, req_headers);
+		} else {
+			auto &pool = ClientPool::Instance();
+			auto pool_key = ClientPoolKey(settings, proto_host_port);
+			auto client = settings.keep_alive ? pool.Acquire(pool_key) : nullptr;
+			string address;
+			if (client) {
+				ConfigureClient(settings, *client);
+			} else {
+				client = CreateClient(settings, proto_host_port, &address);
+			}
+
+			auto start = steady_clock::now();
+			TrackedRequest tracked(settings, client);
+			if (tracked.Cancelled()) {
+				result.error = CANCELLED_ERROR;
+			} else {
+				result = SendRequest(settings, *client, path, method, req_headers, request_body, content_type,
+				                     receiver);
+			}
+			if (result.connect_failed) {
+				ForgetAddress(proto_host_port, address);
+			}
+			if (IsSuccess(result)) {
+				auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+				sudan::HostLatencyTracker::Instance().Record(proto_host_port, latency.count());
+			}
+			// A request that failed or was cut off may have left its connection mid-response
+			if (settings.keep_alive && result.error.empty()) {
+				pool.Release(pool_key, std::move(client));
+			}
+		}
 	} catch (std::exception &e) {
 		result.error = e.what();
 	}
 
+	if (!result.IsHostFailure()) {
+		breaker.RecordSuccess(proto_host_port);
+	} else if (settings.DeadlineExpired() || settings.Cancelled()) {
+		// Requests cut off by our own query deadline or a cancelled scan say nothing about the host
+		breaker.AbandonRequest(proto_host_port);
+	} else {
+		breaker.RecordFailure(proto_host_port, settings.breaker_threshold);
+	}
+
+	if (scheduled) {
+		// Only successful requests tell how loaded the host is
+		uint64_t latency_ms = 0;
+		if (IsSuccess(result)) {
+			auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - request_start);
+			latency_ms = MaxValue<uint64_t>(static_cast<uint64_t>(latency.count()), 1);
+		}
+		scheduler.Release(proto_host_port, settings.request_ticket, latency_ms);
+	}
 	return result;
 }
 
@@ -215,4 +778,70 @@ HttpResponseData HttpClient::Get(const HttpSettings &settings, const string &url
 	return ExecuteHttpRequest(settings, url, "GET", duckdb_httplib_openssl::Headers(), "", "");
 }
 
+// Streaming: Execute a GET request, handing a successful body to the receiver as it arrives
+HttpResponseData HttpClient::Get(const HttpSettings &settings, const string &url, const HttpBodyReceiver &receiver) {
+	return ExecuteHttpRequest(settings, url, "GET", duckdb_httplib_openssl::Headers(), "", "", receiver);
+}
+
+//======================================================================================================================
+// Health Probe
+//======================================================================================================================
+
+HttpProbeResult HttpClient::Probe(const HttpSettings &settings, const string &url) {
+	HttpProbeResult result;
+
+	try {
+		string path;
+		ParseUrl(url, result.host, path);
+
+		auto probe_settings = settings;
+		probe_settings.keep_alive = true;
+		auto client = CreateClient(probe_settings, result.host);
+
+		duckdb_httplib_openssl::Headers headers {{"User-Agent", settings.user_agent}};
+		auto elapsed_ms = [](steady_clock::time_point since) {
+			return std::chrono::duration<double, std::milli>(steady_clock::now() - since).count();
+		};
+
+		// Only the timings and headers matter, the bodies are discarded
+		double first_byte_ms = 0;
+		auto send = [&](steady_clock::time_point start) {
+			return client->Get(
+			    path, headers,
+			    [&](const duckdb_httplib_openssl::Response &) {
+				    first_byte_ms = elapsed_ms(start);
+				    return true;
+			    },
+			    [](const char *, size_t) { return true; });
+		};
+
+		// Cold request: connection setup + server time
+		auto cold_start = steady_clock::now();
+		auto cold = send(cold_start);
+		if (cold.error() != duckdb_httplib_openssl::Error::Success) {
+			result.error = "HTTP request failed: " + to_string(cold.error());
+			result.total_ms = elapsed_ms(cold_start);
+			return result;
+		}
+		result.total_ms = elapsed_ms(cold_start);
+		auto cold_first_byte_ms = first_byte_ms;
+		result.status_code = cold->status;
+		result.rate_limit_limit = cold->get_header_value("X-RateLimit-Limit");
+		result.rate_limit_remaining = cold->get_header_value("X-RateLimit-Remaining");
+		result.retry_after = cold->get_header_value("Retry-After");
+
+		// Warm request on the kept-alive connection: server time only
+		auto warm = send(steady_clock::now());
+		if (warm.error() == duckdb_httplib_openssl::Error::Success) {
+			result.first_byte_ms = first_byte_ms;
+			result.connect_ms = MaxValue(cold_first_byte_ms - first_byte_ms, 0.0);
+		} else {
+			result.first_byte_ms = cold_first_byte_ms;
+		}
+	} catch (std::exception &e) {
+		result.error = e.what();
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -6,8 +6,36 @@
 #define CPPHTTPLIB_OPENSSL_SUPPORT
 #include "httplib.hpp"
 
+#include "sudan/request_scheduler.hpp"
+
+#include <chrono>
+#include <functional>
+
 namespace duckdb {
 
+class SudanQueryState;
+
+//! Requests in flight for one scan. A scan that ends early (LIMIT, error, interrupt) cancels them: their connections
+//! are stopped rather than waited for, and requests sent afterwards fail right away.
+class RequestCancellation {
+public:
+	void Cancel();
+	bool IsCancelled() const;
+	const std::atomic<bool> &Flag() const {
+		return cancelled;
+	}
+
+	//! Track the client of a request while it runs. Returns false, without tracking it, once cancelled.
+	bool Track(const shared_ptr<duckdb_httplib_openssl::Client> &client);
+	void Untrack(const duckdb_httplib_openssl::Client &client);
+
+private:
+	mutable mutex lock;
+	//! Read without the lock by requests waiting for a slot in the RequestScheduler
+	std::atomic<bool> cancelled {false};
+	vector<shared_ptr<duckdb_httplib_openssl::Client>> clients;
+};
+
 //! Struct to hold HTTP settings extracted from context (thread-safe to pass to workers)
 struct HttpSettings {
 	uint64_t timeout;
@@ -19,6 +47,53 @@ struct HttpSettings {
 	uint64_t max_concurrency;
 	bool use_cache;
 	bool follow_redirects;
+
+	//! Per-phase budgets of a single request, in seconds
+	uint64_t connect_timeout;
+	uint64_t first_byte_timeout;
+	uint64_t read_timeout;
+
+	//! Query deadline (sudan_query_timeout seconds after the query started), time_point::max() if none
+	std::chrono::steady_clock::time_point deadline;
+	uint64_t query_timeout;
+	//! Return partial results with warnings instead of failing when the deadline expires
+	bool partial_results;
+
+	//! Duplicate GETs still running after the host's p95 latency, for at most hedge_budget percent of requests
+	bool hedge_requests;
+	double hedge_budget;
+
+	//! Consecutive failures that open a host's circuit (0 = never), and seconds before a half-open probe
+	uint64_t breaker_threshold;
+	uint64_t breaker_cooldown;
+
+	//! Send GETs over the shared HTTP/2 transport instead of one httplib connection per request
+	bool http2;
+
+	//! Seconds a resolved provider address is reused (0 = resolve on every new connection)
+	uint64_t dns_cache_ttl;
+
+	//! Seconds a failed or empty response is remembered, skipping repeats of the request (0 = never)
+	uint64_t negative_cache_ttl;
+
+	//! Priority class, session and share of the connection's requests, and requests that may run against one host
+	//! at once over all connections (0 = no limit)
+	sudan::RequestTicket request_ticket;
+	uint64_t host_concurrency;
+
+	//! Warnings sink of the query the settings were extracted for
+	shared_ptr<SudanQueryState> query_state;
+
+	//! Set by provider scans, so ending the scan aborts its requests (nullptr outside scans)
+	shared_ptr<RequestCancellation> cancellation;
+
+	bool DeadlineExpired() const {
+		return std::chrono::steady_clock::now() >= deadline;
+	}
+
+	bool Cancelled() const {
+		return cancellation && cancellation->IsCancelled();
+	}
 };
 
 //! Struct to hold HTTP response
@@ -26,13 +101,39 @@ struct HttpResponseData {
 	int32_t status_code;
 	string content_type;
 	int64_t content_length;
-	vector<Value> header_keys;
-	vector<Value> header_values;
-	vector<Value> cookies;
+	//! Raw response headers in arrival order; callers read the status, content type and length, and the body
+	vector<pair<string, string>> headers;
 	string body;
 	string error; // Non-empty if request failed
+	bool circuit_open = false; // Failed fast because the host's circuit breaker is open
+	bool connect_failed = false; // The connection to the host could not be established
+
+	//! Transport errors and server errors count against a host; client errors (404, 429, ...) do not
+	bool IsHostFailure() const {
+		return !error.empty() || status_code >= 500;
+	}
+};
+
+//! Result of a health probe of an HTTP endpoint
+struct HttpProbeResult {
+	//! Scheme, host and port, the key of the host's latency and circuit breaker state
+	string host;
+	int32_t status_code = 0;
+	string error;
+	//! TCP connect + TLS handshake: first byte of a request on a new connection minus that of a reused one
+	double connect_ms = 0;
+	//! First byte of a request on the reused (warm) connection
+	double first_byte_ms = 0;
+	//! Complete first request, including connection setup
+	double total_ms = 0;
+	string rate_limit_limit;
+	string rate_limit_remaining;
+	string retry_after;
 };
 
+//! Consumes a response body as it arrives. Returning false aborts the request.
+typedef std::function<bool(const char *data, size_t size)> HttpBodyReceiver;
+
 //! Represents an HTTP request
 struct HttpClient {
 
@@ -42,13 +143,21 @@ struct HttpClient {
 	// Execute HTTP request with given settings
 	static HttpResponseData ExecuteHttpRequest(const HttpSettings &settings, const string &url, const string &method,
 	                                           const duckdb_httplib_openssl::Headers &headers,
-	                                           const string &request_body, const string &content_type);
+	                                           const string &request_body, const string &content_type,
+	                                           const HttpBodyReceiver &receiver = HttpBodyReceiver());
 
 	// Convenience: Execute a GET request and return body
 	static HttpResponseData Get(ClientContext &context, const string &url);
 
 	// Convenience: Execute a GET request with pre-extracted settings
 	static HttpResponseData Get(const HttpSettings &settings, const string &url);
+
+	// Streaming: Execute a GET request, handing a successful (200) body to the receiver as it arrives instead of
+	// buffering it in the response. Not hedged and not sent over HTTP/2.
+	static HttpResponseData Get(const HttpSettings &settings, const string &url, const HttpBodyReceiver &receiver);
+
+	// Probe an endpoint with two GETs on one connection. Bypasses the circuit breaker, hedging and response cache.
+	static HttpProbeResult Probe(const HttpSettings &settings, const string &url);
 };
 
 } // namespace duckdb
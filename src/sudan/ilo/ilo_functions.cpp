@@ -11,9 +11,7 @@
 using namespace duckdb_yyjson; // NOLINT
 
 // SUDAN
-#include "sudan/providers.hpp"
-#include "sudan/http_client.hpp"
-#include "sudan/cache.hpp"
+#include "sudan/provider_scan.hpp"
 
 namespace duckdb {
 
@@ -23,84 +21,43 @@ namespace {
 // SUDAN_ILO
 //======================================================================================================================
 
-struct SudanILO {
+struct ILOScan {
 
-	struct DataRow {
-		string indicator;
-		string country;
-		string sex;
-		string classif1;
-		int32_t year;
-		double value;
-		bool has_value;
+	static constexpr const char *NAME = "SUDAN_ILO";
+	static constexpr const char *BASE_URL = "https://sdmx.ilo.org";
+	static constexpr idx_t ARGUMENT_COUNT = 1;
+	//! The dimension count of a dataflow is probed per request, so each country is fetched on its own
+	static constexpr idx_t BATCH_SIZE = 1;
+
+	static constexpr ProviderColumn COLUMNS[] = {
+	    {"indicator", LogicalTypeId::VARCHAR}, {"country", LogicalTypeId::VARCHAR}, {"sex", LogicalTypeId::VARCHAR},
+	    {"classif1", LogicalTypeId::VARCHAR},  {"year", LogicalTypeId::INTEGER},    {"value", LogicalTypeId::DOUBLE},
 	};
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData final : TableFunctionData {
-		string indicator;
-		std::vector<string> countries;
-
-		explicit BindData(const string &indicator, const std::vector<string> &countries)
-		    : indicator(indicator), countries(std::move(countries)) {
-		}
-	};
-
-	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
-	                                     vector<LogicalType> &return_types, vector<string> &names) {
-
-		D_ASSERT(input.inputs.size() == 1);
-		const string indicator = StringValue::Get(input.inputs[0]);
-
-		if (indicator.empty()) {
+	static void CheckArguments(const vector<string> &args) {
+		if (args[0].empty()) {
 			throw InvalidInputException("SUDAN: The indicator parameter cannot be empty for SUDAN_ILO().");
 		}
-
-		std::vector<string> countries;
-		auto options_param = input.named_parameters.find("countries");
-		if (options_param != input.named_parameters.end()) {
-			auto &items = options_param->second;
-			if (!items.IsNull() && items.type() == LogicalType::LIST(LogicalType::VARCHAR)) {
-				for (const auto &item : ListValue::GetChildren(items)) {
-					countries.push_back(sudan::NormalizeCountryCode(item.GetValue<string>()));
-				}
-			}
-		}
-		if (countries.empty()) {
-			countries.push_back("SDN");
-		}
-
-		names.emplace_back("indicator");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("country");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("sex");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("classif1");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("year");
-		return_types.push_back(LogicalType::INTEGER);
-		names.emplace_back("value");
-		return_types.push_back(LogicalType::DOUBLE);
-
-		return make_uniq_base<FunctionData, BindData>(indicator, countries);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Init
+	// Fetch
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct State final : GlobalTableFunctionState {
-		std::vector<DataRow> rows;
-		idx_t current_row;
-		explicit State() : current_row(0) {
+	static void Fetch(const HttpSettings &settings, const ProviderScanBindData &bind_data,
+	                  const vector<string> &countries, ProviderRowWriter &writer) {
+		for (auto &country_iso3 : countries) {
+			FetchCountry(settings, bind_data, country_iso3, writer);
 		}
-	};
+	}
 
-	static void FetchILOData(const HttpSettings &settings, const string &indicator, const string &country_iso3,
-	                         std::vector<DataRow> &rows) {
+	static void FetchCountry(const HttpSettings &settings, const ProviderScanBindData &bind_data,
+	                         const string &country_iso3, ProviderRowWriter &writer) {
+		auto &indicator = bind_data.args[0];
 
 		// ILOSTAT SDMX REST API for data
 		// Base URL: sdmx.ilo.org/rest (changed from www.ilo.org/sdmx/rest in 2024)
@@ -116,23 +73,17 @@ struct SudanILO {
 		string base = "https://sdmx.ilo.org/rest/data/ILO," + dataflow + "/" +
 		              country_iso3 + ".A";
 		string suffix = "?format=jsondata&detail=dataonly&lastNObservations=20";
+		string year_param = sudan::EncodeILOYearFilter(bind_data.year_filter);
+		if (!year_param.empty()) {
+			suffix += "&" + year_param;
+		}
 
 		// Try keys with 1 to 5 wildcarded dimensions after FREQ
 		static const char *key_suffixes[] = {".", "..", "...", "....", "....."};
 
-		auto &cache = sudan::ResponseCache::Instance();
 		string body;
-
 		for (const auto &ks : key_suffixes) {
-			string url = base + string(ks) + suffix;
-			body = cache.Get(url);
-			if (!body.empty()) {
-				break;
-			}
-			auto response = HttpClient::Get(settings, url);
-			if (response.status_code == 200 && response.error.empty() && !response.body.empty()) {
-				body = response.body;
-				cache.Put(url, body);
+			if (FetchCached(settings, base + string(ks) + suffix, body)) {
 				break;
 			}
 		}
@@ -317,30 +268,28 @@ struct SudanILO {
 				while ((obs_key = yyjson_obj_iter_next(&obs_iter))) {
 					obs_val = yyjson_obj_iter_get_val(obs_key);
 
-					DataRow row;
-					row.indicator = indicator;
-					row.country = country_iso3;
-					row.sex = sex;
-					row.classif1 = classif1;
-					row.has_value = false;
+					// Only observations with a value are emitted
+					double value;
+					if (!ExtractObsValue(obs_val, value)) {
+						continue;
+					}
 
 					// Observation key maps to observation dimensions (typically TIME_PERIOD)
 					string ok = yyjson_get_str(obs_key);
 					auto obs_indices = ParseKeyIndices(ok);
 					string time_str = LookupDimValue(obs_dims, "TIME_PERIOD", obs_indices);
-					try {
-						row.year = std::stoi(time_str);
-					} catch (...) {
-						row.year = 0;
-					}
 
-					if (ExtractObsValue(obs_val, row.value)) {
-						row.has_value = true;
+					writer.NewRow();
+					writer.SetString(0, indicator);
+					writer.SetString(1, country_iso3);
+					if (!sex.empty()) {
+						writer.SetString(2, sex);
 					}
-
-					if (row.has_value) {
-						rows.push_back(row);
+					if (!classif1.empty()) {
+						writer.SetString(3, classif1);
 					}
+					writer.SetInteger(4, ParseYear(time_str.c_str()));
+					writer.SetDouble(5, value);
 				}
 			}
 		}
@@ -348,53 +297,6 @@ struct SudanILO {
 		yyjson_doc_free(json_data);
 	}
 
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
-		auto &state = global_state->Cast<State>();
-
-		HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://sdmx.ilo.org");
-		settings.timeout = 90;
-
-		for (const auto &country : bind_data.countries) {
-			FetchILOData(settings, bind_data.indicator, country, state.rows);
-		}
-
-		return global_state;
-	}
-
-	//------------------------------------------------------------------------------------------------------------------
-	// Execute
-	//------------------------------------------------------------------------------------------------------------------
-
-	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
-		auto &state = input.global_state->Cast<State>();
-
-		const auto output_size = std::min<idx_t>(STANDARD_VECTOR_SIZE, state.rows.size() - state.current_row);
-
-		if (output_size == 0) {
-			output.SetCardinality(0);
-			return;
-		}
-
-		for (idx_t row_idx = 0; row_idx < output_size; row_idx++) {
-			const auto &row = state.rows[state.current_row + row_idx];
-			output.data[0].SetValue(row_idx, row.indicator);
-			output.data[1].SetValue(row_idx, row.country);
-			output.data[2].SetValue(row_idx, row.sex.empty() ? Value() : Value(row.sex));
-			output.data[3].SetValue(row_idx, row.classif1.empty() ? Value() : Value(row.classif1));
-			output.data[4].SetValue(row_idx, Value::INTEGER(row.year));
-			if (row.has_value) {
-				output.data[5].SetValue(row_idx, Value::DOUBLE(row.value));
-			} else {
-				output.data[5].SetValue(row_idx, Value());
-			}
-		}
-
-		state.current_row += output_size;
-		output.SetCardinality(output_size);
-	}
-
 	//------------------------------------------------------------------------------------------------------------------
 	// Documentation
 	//------------------------------------------------------------------------------------------------------------------
@@ -410,20 +312,10 @@ struct SudanILO {
 		-- Compare with neighbors
 		SELECT * FROM SUDAN_ILO('UNE_DEAP_SEX_AGE_RT', countries := ['SDN', 'EGY']);
 	)";
-
-	static void Register(ExtensionLoader &loader) {
-
-		InsertionOrderPreservingMap<string> tags;
-		tags.insert("ext", "sudan");
-		tags.insert("category", "table");
-
-		TableFunction func("SUDAN_ILO", {LogicalType::VARCHAR}, Execute, Bind, Init);
-		func.named_parameters["countries"] = LogicalType::LIST(LogicalType::VARCHAR);
-
-		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
-	}
 };
 
+constexpr ProviderColumn ILOScan::COLUMNS[];
+
 } // namespace
 
 //======================================================================================================================
@@ -431,7 +323,21 @@ struct SudanILO {
 //======================================================================================================================
 
 void ILOFunctions::Register(ExtensionLoader &loader) {
-	SudanILO::Register(loader);
+	ProviderScan<ILOScan>::Register(loader);
+}
+
+TableFunction ILOFunctions::GetCatalogScan(const string &indicator, const vector<string> &countries,
+                                           vector<LogicalType> &return_types, vector<string> &names,
+                                           unique_ptr<FunctionData> &bind_data) {
+	return ProviderScan<ILOScan>::GetCatalogScan({indicator}, countries, return_types, names, bind_data);
+}
+
+bool ILOFunctions::IndicatorExists(ClientContext &context, const string &indicator) {
+	auto dataflow = StringUtil::StartsWith(indicator, "DF_") ? indicator : "DF_" + indicator;
+	HttpSettings settings = HttpClient::ExtractHttpSettings(context, ILOScan::BASE_URL);
+	// Unknown dataflows answer 404, so any response body means the dataflow is defined
+	string body;
+	return FetchCached(settings, "https://sdmx.ilo.org/rest/dataflow/ILO/" + StringUtil::URLEncode(dataflow), body);
 }
 
 } // namespace duckdb
@@ -13,6 +13,13 @@ using namespace duckdb_yyjson; // NOLINT
 // SUDAN
 #include "sudan/providers.hpp"
 #include "sudan/http_client.hpp"
+#include "sudan/query_budget.hpp"
+#include "sudan/latency_tracker.hpp"
+#include "sudan/circuit_breaker.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 namespace duckdb {
 
@@ -30,7 +37,8 @@ struct SudanProviders {
 
 	struct BindData final : TableFunctionData {
 		idx_t provider_count;
-		explicit BindData(const idx_t count_p) : provider_count(count_p) {
+		bool probe;
+		BindData(const idx_t count_p, bool probe_p) : provider_count(count_p), probe(probe_p) {
 		}
 	};
 
@@ -48,7 +56,83 @@ struct SudanProviders {
 		names.emplace_back("base_url");
 		return_types.push_back(LogicalType::VARCHAR);
 
-		return make_uniq_base<FunctionData, BindData>(sudan::PROVIDERS.size());
+		bool probe = false;
+		auto probe_param = input.named_parameters.find("probe");
+		if (probe_param != input.named_parameters.end() && !probe_param->second.IsNull()) {
+			probe = BooleanValue::Get(probe_param->second);
+		}
+
+		if (probe) {
+			names.emplace_back("reachable");
+			return_types.push_back(LogicalType::BOOLEAN);
+			names.emplace_back("status_code");
+			return_types.push_back(LogicalType::INTEGER);
+			names.emplace_back("connect_ms");
+			return_types.push_back(LogicalType::DOUBLE);
+			names.emplace_back("first_byte_ms");
+			return_types.push_back(LogicalType::DOUBLE);
+			names.emplace_back("total_ms");
+			return_types.push_back(LogicalType::DOUBLE);
+			names.emplace_back("observed_p95_ms");
+			return_types.push_back(LogicalType::BIGINT);
+			names.emplace_back("rate_limit_limit");
+			return_types.push_back(LogicalType::VARCHAR);
+			names.emplace_back("rate_limit_remaining");
+			return_types.push_back(LogicalType::VARCHAR);
+			names.emplace_back("retry_after");
+			return_types.push_back(LogicalType::VARCHAR);
+			names.emplace_back("circuit_state");
+			return_types.push_back(LogicalType::VARCHAR);
+			names.emplace_back("error");
+			return_types.push_back(LogicalType::VARCHAR);
+		}
+
+		return make_uniq_base<FunctionData, BindData>(sudan::PROVIDERS.size(), probe);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Probe
+	//------------------------------------------------------------------------------------------------------------------
+
+	//! Probe results are cached briefly so dashboards polling SUDAN_Providers(probe := true) do not hammer upstreams
+	static constexpr int PROBE_TTL_SECONDS = 10;
+
+	struct ProbeCache {
+		std::mutex mutex;
+		std::chrono::steady_clock::time_point probed_at;
+		vector<HttpProbeResult> results;
+	};
+
+	static ProbeCache &GetProbeCache() {
+		static ProbeCache cache;
+		return cache;
+	}
+
+	static vector<HttpProbeResult> ProbeProviders(ClientContext &context) {
+		auto &cache = GetProbeCache();
+		std::lock_guard<std::mutex> guard(cache.mutex);
+		auto now = std::chrono::steady_clock::now();
+		if (!cache.results.empty() && now - cache.probed_at < std::chrono::seconds(PROBE_TTL_SECONDS)) {
+			return cache.results;
+		}
+
+		// All providers are probed at once, so the query takes as long as the slowest upstream
+		vector<HttpProbeResult> results(sudan::PROVIDERS.size());
+		vector<std::thread> threads;
+		for (idx_t i = 0; i < sudan::PROVIDERS.size(); i++) {
+			auto &base_url = sudan::PROVIDERS[i].base_url;
+			auto settings = HttpClient::ExtractHttpSettings(context, base_url);
+			threads.emplace_back([&results, i, settings, base_url]() {
+				results[i] = HttpClient::Probe(settings, base_url);
+			});
+		}
+		for (auto &thread : threads) {
+			thread.join();
+		}
+
+		cache.results = results;
+		cache.probed_at = std::chrono::steady_clock::now();
+		return results;
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -57,18 +141,28 @@ struct SudanProviders {
 
 	struct State final : GlobalTableFunctionState {
 		idx_t current_idx;
+		vector<HttpProbeResult> probes;
 		explicit State() : current_idx(0) {
 		}
 	};
 
 	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		return make_uniq_base<GlobalTableFunctionState, State>();
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto state = make_uniq<State>();
+		if (bind_data.probe) {
+			state->probes = ProbeProviders(context);
+		}
+		return std::move(state);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Execute
 	//------------------------------------------------------------------------------------------------------------------
 
+	static Value OptionalString(const string &str) {
+		return str.empty() ? Value() : Value(str);
+	}
+
 	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
 		auto &bind_data = input.bind_data->Cast<BindData>();
 		auto &state = input.global_state->Cast<State>();
@@ -84,6 +178,25 @@ struct SudanProviders {
 			output.data[2].SetValue(count, provider.name_ar);
 			output.data[3].SetValue(count, provider.description);
 			output.data[4].SetValue(count, provider.base_url);
+
+			if (bind_data.probe) {
+				const auto &probe = state.probes[state.current_idx];
+				auto reachable = probe.error.empty() && probe.status_code > 0;
+				auto stats = sudan::HostLatencyTracker::Instance().GetStats(probe.host);
+				auto circuit = sudan::CircuitBreaker::Instance().GetState(probe.host);
+
+				output.data[5].SetValue(count, Value::BOOLEAN(reachable));
+				output.data[6].SetValue(count, reachable ? Value::INTEGER(probe.status_code) : Value());
+				output.data[7].SetValue(count, reachable ? Value::DOUBLE(probe.connect_ms) : Value());
+				output.data[8].SetValue(count, reachable ? Value::DOUBLE(probe.first_byte_ms) : Value());
+				output.data[9].SetValue(count, Value::DOUBLE(probe.total_ms));
+				output.data[10].SetValue(count, stats.p95_ms > 0 ? Value::BIGINT(stats.p95_ms) : Value());
+				output.data[11].SetValue(count, OptionalString(probe.rate_limit_limit));
+				output.data[12].SetValue(count, OptionalString(probe.rate_limit_remaining));
+				output.data[13].SetValue(count, OptionalString(probe.retry_after));
+				output.data[14].SetValue(count, sudan::CircuitBreaker::StateName(circuit));
+				output.data[15].SetValue(count, OptionalString(probe.error));
+			}
 			count++;
 		}
 		output.SetCardinality(count);
@@ -95,6 +208,9 @@ struct SudanProviders {
 
 	static constexpr auto DESCRIPTION = R"(
 		Returns the list of supported data providers for Sudan data.
+		With probe := true, all provider endpoints are probed concurrently and the result adds reachability,
+		connection and first-byte timings, the observed p95 latency, rate-limit headers and the circuit breaker
+		state of each provider. Probe results are cached for 10 seconds.
 	)";
 
 	static constexpr auto EXAMPLE = R"(
@@ -109,6 +225,129 @@ struct SudanProviders {
 		| unhcr     | UNHCR                       | UN Refugee Agency displacement and pop...    |
 		| ilo       | International Labour Org... | International Labour Organization statistics |
 		+-----------+-----------------------------+----------------------------------------------+
+
+		-- Which upstreams are slow or down right now?
+		SELECT provider_id, reachable, connect_ms, first_byte_ms, circuit_state
+		FROM SUDAN_Providers(probe := true);
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		TableFunction func("SUDAN_Providers", {}, Execute, Bind, Init);
+		func.named_parameters["probe"] = LogicalType::BOOLEAN;
+
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+	}
+};
+
+//======================================================================================================================
+// SUDAN_Countries
+//======================================================================================================================
+
+struct SudanCountries {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		names.emplace_back("iso3");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("iso2");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("m49");
+		return_types.push_back(LogicalType::SMALLINT);
+		names.emplace_back("fao_area");
+		return_types.push_back(LogicalType::SMALLINT);
+		names.emplace_back("name");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("name_ar");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("groups");
+		return_types.push_back(LogicalType::LIST(LogicalType::VARCHAR));
+
+		return make_uniq<TableFunctionData>();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct State final : GlobalTableFunctionState {
+		idx_t current_idx;
+		explicit State() : current_idx(0) {
+		}
+	};
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		return make_uniq_base<GlobalTableFunctionState, State>();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &state = input.global_state->Cast<State>();
+
+		idx_t count = 0;
+		auto next_idx = MinValue<idx_t>(state.current_idx + STANDARD_VECTOR_SIZE, sudan::CountryCount());
+
+		for (; state.current_idx < next_idx; state.current_idx++) {
+			const auto &country = sudan::GetCountry(state.current_idx);
+
+			output.data[0].SetValue(count, country.iso3);
+			output.data[1].SetValue(count, country.iso2);
+			output.data[2].SetValue(count, Value::SMALLINT(country.m49));
+			output.data[3].SetValue(count, country.fao_area ? Value::SMALLINT(country.fao_area) : Value());
+			output.data[4].SetValue(count, country.name);
+			output.data[5].SetValue(count, country.name_ar);
+
+			vector<Value> groups;
+			for (idx_t i = 0; i < sudan::CountryGroupCount(); i++) {
+				const auto &group = sudan::GetCountryGroup(i);
+				if (country.groups & group.mask) {
+					groups.emplace_back("@" + string(group.name));
+				}
+			}
+			output.data[6].SetValue(count, Value::LIST(LogicalType::VARCHAR, std::move(groups)));
+			count++;
+		}
+		output.SetCardinality(count);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Returns the ISO 3166-1 country table used to resolve the `countries` parameter of all providers:
+		ISO alpha-3/alpha-2 codes, UN M49 code, FAOSTAT area code, English/Arabic names and the
+		country groups (e.g. '@IGAD') that can be passed to `countries` instead of individual codes.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SELECT iso3, iso2, m49, fao_area, name FROM SUDAN_Countries() WHERE iso3 IN ('SDN', 'SSD');
+
+		+------+------+-----+----------+-------------+
+		| iso3 | iso2 | m49 | fao_area |    name     |
+		+------+------+-----+----------+-------------+
+		| SSD  | SS   | 728 |      277 | South Sudan |
+		| SDN  | SD   | 729 |      276 | Sudan       |
+		+------+------+-----+----------+-------------+
+
+		-- Members of a group
+		SELECT iso3, name FROM SUDAN_Countries() WHERE list_contains(groups, '@IGAD');
 	)";
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -121,7 +360,7 @@ struct SudanProviders {
 		tags.insert("ext", "sudan");
 		tags.insert("category", "table");
 
-		const TableFunction func("SUDAN_Providers", {}, Execute, Bind, Init);
+		const TableFunction func("SUDAN_Countries", {}, Execute, Bind, Init);
 		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
 	}
 };
@@ -371,6 +610,93 @@ struct SudanSearch {
 	}
 };
 
+//======================================================================================================================
+// SUDAN_Warnings
+//======================================================================================================================
+
+struct SudanWarnings {
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+
+		names.emplace_back("source");
+		return_types.push_back(LogicalType::VARCHAR);
+		names.emplace_back("message");
+		return_types.push_back(LogicalType::VARCHAR);
+
+		return make_uniq<TableFunctionData>();
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
+
+	struct State final : GlobalTableFunctionState {
+		vector<pair<string, string>> warnings;
+		idx_t current_idx = 0;
+	};
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto state = make_uniq<State>();
+		state->warnings = SudanQueryState::Get(context)->Warnings();
+		return std::move(state);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Execute
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+		auto &state = input.global_state->Cast<State>();
+
+		idx_t count = 0;
+		auto next_idx = MinValue<idx_t>(state.current_idx + STANDARD_VECTOR_SIZE, state.warnings.size());
+
+		for (; state.current_idx < next_idx; state.current_idx++) {
+			const auto &warning = state.warnings[state.current_idx];
+			output.data[0].SetValue(count, warning.first);
+			output.data[1].SetValue(count, warning.second);
+			count++;
+		}
+		output.SetCardinality(count);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Documentation
+	//------------------------------------------------------------------------------------------------------------------
+
+	static constexpr auto DESCRIPTION = R"(
+		Returns the warnings of the most recent query that produced any, e.g. providers cut off by
+		sudan_query_timeout when sudan_partial_results is enabled, failed requests and stale cached
+		responses served while a provider's circuit breaker was open.
+	)";
+
+	static constexpr auto EXAMPLE = R"(
+		SET sudan_query_timeout = 20;
+		SET sudan_partial_results = true;
+		SELECT * FROM SUDAN_WorldBank('SP.POP.TOTL', countries := ['@AFRICA']);
+		SELECT * FROM SUDAN_Warnings();
+	)";
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		const TableFunction func("SUDAN_Warnings", {}, Execute, Bind, Init);
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
+	}
+};
+
 } // namespace
 
 //======================================================================================================================
@@ -379,7 +705,9 @@ struct SudanSearch {
 
 void InfoFunctions::Register(ExtensionLoader &loader) {
 	SudanProviders::Register(loader);
+	SudanCountries::Register(loader);
 	SudanSearch::Register(loader);
+	SudanWarnings::Register(loader);
 }
 
 } // namespace duckdb
@@ -0,0 +1,63 @@
+#include "io_pool.hpp"
+
+namespace sudan {
+
+IoPool::~IoPool() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	task_queued_.notify_all();
+	for (auto &thread : threads_) {
+		thread.join();
+	}
+}
+
+void IoPool::Submit(const void *owner, std::function<void()> task) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	queue_.push_back(Task {owner, std::move(task)});
+	if (idle_ < queue_.size() && threads_.size() < MAX_THREADS) {
+		threads_.emplace_back([this]() { Work(); });
+	}
+	task_queued_.notify_one();
+}
+
+void IoPool::Cancel(const void *owner) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	task_done_.wait(lock, [&]() { return running_.find(owner) == running_.end(); });
+	for (auto it = queue_.begin(); it != queue_.end();) {
+		it = it->owner == owner ? queue_.erase(it) : std::next(it);
+	}
+}
+
+void IoPool::Work() {
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (true) {
+		idle_++;
+		task_queued_.wait(lock, [&]() { return stopping_ || !queue_.empty(); });
+		idle_--;
+		if (stopping_) {
+			return;
+		}
+		auto task = std::move(queue_.front());
+		queue_.pop_front();
+		running_[task.owner]++;
+
+		lock.unlock();
+		task.run();
+		lock.lock();
+
+		auto running = running_.find(task.owner);
+		if (--running->second == 0) {
+			running_.erase(running);
+		}
+		task_done_.notify_all();
+	}
+}
+
+IoPool &IoPool::Instance() {
+	static IoPool instance;
+	return instance;
+}
+
+} // namespace sudan
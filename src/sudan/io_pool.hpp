@@ -0,0 +1,55 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sudan {
+
+//! Process-wide pool of threads for blocking provider requests, shared by all scans like the response cache.
+//!
+//! Scans queue their batch fetches here instead of starting threads of their own, so the number of I/O threads
+//! stays bounded however many scans run at once. Threads are started on demand, up to MAX_THREADS, and tasks
+//! beyond that wait in arrival order.
+class IoPool {
+public:
+	~IoPool();
+
+	//! Queue a task of an owner (a scan), run on one of the pool's threads
+	void Submit(const void *owner, std::function<void()> task);
+
+	//! Wait until no task of the owner runs, then drop its queued ones. Only running tasks may submit more for the
+	//! owner, so none can start afterwards.
+	void Cancel(const void *owner);
+
+	static IoPool &Instance();
+
+	static constexpr uint64_t MAX_THREADS = 64;
+
+private:
+	struct Task {
+		const void *owner;
+		std::function<void()> run;
+	};
+
+	void Work();
+
+	std::mutex mutex_;
+	//! Signalled when a task is queued or the pool shuts down
+	std::condition_variable task_queued_;
+	//! Signalled when a task finishes
+	std::condition_variable task_done_;
+	std::deque<Task> queue_;
+	//! Running tasks per owner
+	std::unordered_map<const void *, uint64_t> running_;
+	std::vector<std::thread> threads_;
+	uint64_t idle_ = 0;
+	bool stopping_ = false;
+};
+
+} // namespace sudan
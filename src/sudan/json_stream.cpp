@@ -0,0 +1,108 @@
+#include "json_stream.hpp"
+
+#include <utility>
+
+namespace sudan {
+
+JsonArrayStream::JsonArrayStream(std::string key, element_callback_t on_element)
+    : key_(std::move(key)), on_element_(std::move(on_element)), state_(State::ROOT), depth_(0), in_string_(false),
+      escaped_(false), expect_key_(false), reading_key_(false), element_count_(0) {
+}
+
+void JsonArrayStream::EmitElement() {
+	auto start = element_.find_first_not_of(" \t\r\n");
+	if (start != std::string::npos) {
+		auto end = element_.find_last_not_of(" \t\r\n");
+		on_element_(element_.data() + start, end - start + 1);
+		element_count_++;
+	}
+	element_.clear();
+}
+
+bool JsonArrayStream::Feed(const char *data, size_t size) {
+	// Bytes of the current element in this buffer are appended in one go rather than one at a time
+	size_t element_start = 0;
+	auto flush_element = [&](size_t end) {
+		if (state_ == State::ARRAY && end > element_start) {
+			element_.append(data + element_start, end - element_start);
+		}
+	};
+
+	for (size_t i = 0; i < size && state_ != State::DONE && state_ != State::MALFORMED; i++) {
+		auto c = data[i];
+
+		if (in_string_) {
+			if (escaped_) {
+				escaped_ = false;
+			} else if (c == '\\') {
+				escaped_ = true;
+			} else if (c == '"') {
+				in_string_ = false;
+				reading_key_ = false;
+			} else if (reading_key_) {
+				current_key_ += c;
+			}
+			continue;
+		}
+
+		switch (c) {
+		case '"':
+			in_string_ = true;
+			if (depth_ == 1 && expect_key_) {
+				reading_key_ = true;
+				current_key_.clear();
+			}
+			break;
+		case ':':
+			if (depth_ == 1) {
+				expect_key_ = false;
+			}
+			break;
+		case '{':
+		case '[':
+			if (depth_ == 0 && c != '{') {
+				state_ = State::MALFORMED;
+				break;
+			}
+			depth_++;
+			if (depth_ == 1) {
+				expect_key_ = true;
+			} else if (depth_ == 2 && c == '[' && state_ == State::ROOT && current_key_ == key_) {
+				// The elements start after the bracket
+				state_ = State::ARRAY;
+				element_start = i + 1;
+			}
+			break;
+		case ',':
+			if (depth_ == 1) {
+				expect_key_ = true;
+			} else if (depth_ == 2 && state_ == State::ARRAY) {
+				flush_element(i);
+				EmitElement();
+				element_start = i + 1;
+			}
+			break;
+		case '}':
+		case ']':
+			if (depth_ == 0) {
+				state_ = State::MALFORMED;
+				break;
+			}
+			if (depth_ == 2 && state_ == State::ARRAY) {
+				// Closing the array itself
+				flush_element(i);
+				EmitElement();
+				state_ = State::DONE;
+			}
+			depth_--;
+			break;
+		default:
+			break;
+		}
+	}
+
+	flush_element(size);
+	return state_ != State::MALFORMED;
+}
+
+} // namespace sudan
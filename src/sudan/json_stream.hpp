@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace sudan {
+
+//! Incremental tokenizer for a JSON document of the form {..., "<key>": [elem, elem, ...], ...}.
+//!
+//! Bytes are fed as they arrive from the network; each element of the array under `key` is handed out as soon as it
+//! is complete, as the raw JSON text of that element. Only the element being read is buffered, so memory stays bounded
+//! by the largest element rather than the size of the response.
+class JsonArrayStream {
+public:
+	typedef std::function<void(const char *element, size_t length)> element_callback_t;
+
+	JsonArrayStream(std::string key, element_callback_t on_element);
+
+	//! Consume the next bytes of the document. Returns false once the document is found to be malformed.
+	bool Feed(const char *data, size_t size);
+
+	//! Whether the array was found and closed
+	bool Complete() const {
+		return state_ == State::DONE;
+	}
+
+	//! Number of elements handed out so far
+	size_t ElementCount() const {
+		return element_count_;
+	}
+
+private:
+	enum class State { ROOT, ARRAY, DONE, MALFORMED };
+
+	//! Hand out the buffered element, if any
+	void EmitElement();
+
+	std::string key_;
+	element_callback_t on_element_;
+
+	State state_;
+	//! Container depth: 1 inside the root object, 2 inside one of its arrays or objects, ...
+	size_t depth_;
+	bool in_string_;
+	bool escaped_;
+	//! At depth 1, whether the next string is a key (rather than a value)
+	bool expect_key_;
+	//! Last key read at depth 1
+	std::string current_key_;
+	bool reading_key_;
+	//! Text of the array element being read
+	std::string element_;
+	size_t element_count_;
+};
+
+} // namespace sudan
@@ -0,0 +1,79 @@
+#include "latency_tracker.hpp"
+
+#include <algorithm>
+
+namespace sudan {
+
+void HostLatencyTracker::Record(const std::string &host, uint64_t latency_ms) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	auto sample = static_cast<uint32_t>(std::min<uint64_t>(latency_ms, UINT32_MAX));
+	if (state.samples.size() < WINDOW) {
+		state.samples.push_back(sample);
+	} else {
+		state.samples[state.next_sample] = sample;
+	}
+	state.next_sample = (state.next_sample + 1) % WINDOW;
+}
+
+uint64_t HostLatencyTracker::Percentile(const HostState &state, double percentile) {
+	if (state.samples.size() < MIN_SAMPLES) {
+		return 0;
+	}
+	auto sorted = state.samples;
+	auto rank = static_cast<size_t>(percentile * static_cast<double>(sorted.size() - 1));
+	std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(rank), sorted.end());
+	return sorted[rank];
+}
+
+uint64_t HostLatencyTracker::HedgeDelay(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	state.requests++;
+	auto p95 = Percentile(state, 0.95);
+	if (p95 == 0) {
+		return 0;
+	}
+	if (p95 < MIN_HEDGE_DELAY_MS) {
+		return MIN_HEDGE_DELAY_MS;
+	}
+	return p95;
+}
+
+bool HostLatencyTracker::TryHedge(const std::string &host, double budget_percent) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	if (static_cast<double>(state.hedges + 1) > static_cast<double>(state.requests) * budget_percent / 100.0) {
+		return false;
+	}
+	state.hedges++;
+	return true;
+}
+
+void HostLatencyTracker::RecordHedgeWin(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	hosts_[host].hedge_wins++;
+}
+
+HostLatencyTracker::HostStats HostLatencyTracker::GetStats(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	HostStats stats;
+	auto entry = hosts_.find(host);
+	if (entry == hosts_.end()) {
+		return stats;
+	}
+	auto &state = entry->second;
+	stats.requests = state.requests;
+	stats.hedges = state.hedges;
+	stats.hedge_wins = state.hedge_wins;
+	stats.p50_ms = Percentile(state, 0.50);
+	stats.p95_ms = Percentile(state, 0.95);
+	return stats;
+}
+
+HostLatencyTracker &HostLatencyTracker::Instance() {
+	static HostLatencyTracker instance;
+	return instance;
+}
+
+} // namespace sudan
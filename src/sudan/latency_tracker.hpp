@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace sudan {
+
+//! Recent request latencies and hedging counters per host, shared by all connections like the response cache.
+//! Drives hedged requests: a GET still running after the host's p95 latency gets a duplicate on a second connection.
+class HostLatencyTracker {
+public:
+	struct HostStats {
+		//! Requests that could have been hedged
+		uint64_t requests = 0;
+		//! Duplicates fired
+		uint64_t hedges = 0;
+		//! Hedges that answered before the original request
+		uint64_t hedge_wins = 0;
+		//! Latency percentiles over the recent window in milliseconds, 0 until MIN_SAMPLES requests completed
+		uint64_t p50_ms = 0;
+		uint64_t p95_ms = 0;
+	};
+
+	//! Record the latency of a successful request
+	void Record(const std::string &host, uint64_t latency_ms);
+
+	//! Count a hedgeable request and return the delay after which it may be hedged, 0 if it must not be
+	uint64_t HedgeDelay(const std::string &host);
+
+	//! Reserve a hedge if the host's hedges stay within budget_percent of its requests
+	bool TryHedge(const std::string &host, double budget_percent);
+
+	void RecordHedgeWin(const std::string &host);
+
+	HostStats GetStats(const std::string &host);
+
+	static HostLatencyTracker &Instance();
+
+private:
+	struct HostState {
+		//! Ring buffer of the last WINDOW latencies
+		std::vector<uint32_t> samples;
+		size_t next_sample = 0;
+		uint64_t requests = 0;
+		uint64_t hedges = 0;
+		uint64_t hedge_wins = 0;
+	};
+
+	static uint64_t Percentile(const HostState &state, double percentile);
+
+	std::unordered_map<std::string, HostState> hosts_;
+	std::mutex mutex_;
+
+	static constexpr size_t WINDOW = 128;
+	static constexpr size_t MIN_SAMPLES = 20;
+	//! Never hedge sooner than this, duplicates of fast requests only add load
+	static constexpr uint64_t MIN_HEDGE_DELAY_MS = 50;
+};
+
+} // namespace sudan
@@ -0,0 +1,804 @@
+#include "provider_scan.hpp"
+
+// DuckDB
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/function/create_sort_key.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+
+// SUDAN
+#include "sudan/providers.hpp"
+#include "sudan/cache.hpp"
+#include "sudan/query_budget.hpp"
+#include "sudan/json_stream.hpp"
+#include "sudan/io_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace duckdb_yyjson; // NOLINT
+
+namespace duckdb {
+
+//======================================================================================================================
+// ProviderScanBindData
+//======================================================================================================================
+
+ProviderScanBindData::ProviderScanBindData(vector<string> args_p, vector<string> countries_p,
+                                           vector<LogicalType> types_p, idx_t year_column_p)
+    : args(std::move(args_p)), countries(std::move(countries_p)), types(std::move(types_p)) {
+	year_column = year_column_p;
+}
+
+vector<string> ProviderScanBindData::ParseCountries(const named_parameter_map_t &named_parameters) {
+	vector<string> countries;
+	auto options_param = named_parameters.find("countries");
+	if (options_param != named_parameters.end()) {
+		auto &items = options_param->second;
+		if (!items.IsNull() && items.type() == LogicalType::LIST(LogicalType::VARCHAR)) {
+			for (const auto &item : ListValue::GetChildren(items)) {
+				AddCountries(item.GetValue<string>(), countries);
+			}
+		}
+	}
+	if (countries.empty()) {
+		countries.push_back("SDN");
+	}
+	return countries;
+}
+
+void ProviderScanBindData::AddCountries(const string &code, vector<string> &countries) {
+	vector<string> resolved;
+	if (!code.empty() && code[0] == '@') {
+		auto group = sudan::FindCountryGroup(code);
+		if (!group) {
+			vector<string> group_names;
+			for (idx_t i = 0; i < sudan::CountryGroupCount(); i++) {
+				group_names.push_back("@" + string(sudan::GetCountryGroup(i).name));
+			}
+			throw InvalidInputException("SUDAN: Unknown country group '%s'. Available groups: %s.", code,
+			                            StringUtil::Join(group_names, ", "));
+		}
+		resolved = sudan::GetGroupMembers(*group);
+	} else {
+		resolved.push_back(ResolveCountry(code));
+	}
+
+	// Overlapping entries (e.g. ['SDN', '@IGAD']) must not fetch a country twice
+	for (auto &iso3 : resolved) {
+		if (std::find(countries.begin(), countries.end(), iso3) == countries.end()) {
+			countries.push_back(std::move(iso3));
+		}
+	}
+}
+
+void ProviderScanBindData::ParseSorted(const named_parameter_map_t &named_parameters, idx_t batch_size) {
+	auto sorted_param = named_parameters.find("sorted");
+	if (sorted_param == named_parameters.end() || sorted_param->second.IsNull() ||
+	    !BooleanValue::Get(sorted_param->second)) {
+		return;
+	}
+	sorted = true;
+
+	// Batches are emitted in request order, which need not match the order of the country codes the API returns.
+	// Only a single batch is sorted as a whole.
+	if (countries.size() <= MaxValue<idx_t>(batch_size, 1)) {
+		if (country_column != DConstants::INVALID_INDEX) {
+			output_order.push_back(country_column);
+		}
+		if (year_column != DConstants::INVALID_INDEX) {
+			output_order.push_back(year_column);
+		}
+	}
+}
+
+string ProviderScanBindData::ResolveCountry(const string &code) {
+	auto country = sudan::FindCountry(code);
+	if (!country) {
+		throw InvalidInputException(
+		    "SUDAN: Unknown country code '%s'. Use ISO 3166 alpha-3 (e.g. 'SDN'), alpha-2 ('SD') or M49 ('729') codes.",
+		    code);
+	}
+	return country->iso3;
+}
+
+//======================================================================================================================
+// ProviderRowWriter
+//======================================================================================================================
+
+ProviderRowWriter::ProviderRowWriter(const vector<LogicalType> &types, provider_chunk_sink_t sink)
+    : types(types), sink(std::move(sink)), chunk_row(0), has_row(false), row_count(0) {
+}
+
+void ProviderRowWriter::FlushChunk() {
+	if (!has_row) {
+		return;
+	}
+	chunk->SetCardinality(chunk_row + 1);
+	sink(*chunk);
+	chunk->Reset();
+	chunk_row = 0;
+	has_row = false;
+}
+
+void ProviderRowWriter::NewRow() {
+	if (has_row) {
+		if (chunk_row + 1 == STANDARD_VECTOR_SIZE) {
+			FlushChunk();
+		} else {
+			chunk_row++;
+		}
+	}
+	if (!chunk) {
+		chunk = make_uniq<DataChunk>();
+		chunk->Initialize(Allocator::DefaultAllocator(), types);
+	}
+	for (auto &vec : chunk->data) {
+		FlatVector::SetNull(vec, chunk_row, true);
+	}
+	has_row = true;
+	row_count++;
+}
+
+void ProviderRowWriter::SetString(idx_t col, const char *str) {
+	auto &vec = chunk->data[col];
+	FlatVector::GetData<string_t>(vec)[chunk_row] = StringVector::AddString(vec, str, strlen(str));
+	FlatVector::Validity(vec).SetValid(chunk_row);
+}
+
+void ProviderRowWriter::SetString(idx_t col, const string &str) {
+	auto &vec = chunk->data[col];
+	FlatVector::GetData<string_t>(vec)[chunk_row] = StringVector::AddString(vec, str);
+	FlatVector::Validity(vec).SetValid(chunk_row);
+}
+
+void ProviderRowWriter::SetInteger(idx_t col, int32_t value) {
+	auto &vec = chunk->data[col];
+	FlatVector::GetData<int32_t>(vec)[chunk_row] = value;
+	FlatVector::Validity(vec).SetValid(chunk_row);
+}
+
+void ProviderRowWriter::SetBigint(idx_t col, int64_t value) {
+	auto &vec = chunk->data[col];
+	FlatVector::GetData<int64_t>(vec)[chunk_row] = value;
+	FlatVector::Validity(vec).SetValid(chunk_row);
+}
+
+void ProviderRowWriter::SetDouble(idx_t col, double value) {
+	auto &vec = chunk->data[col];
+	FlatVector::GetData<double>(vec)[chunk_row] = value;
+	FlatVector::Validity(vec).SetValid(chunk_row);
+}
+
+void ProviderRowWriter::Finish() {
+	FlushChunk();
+}
+
+//======================================================================================================================
+// ProviderScanState
+//======================================================================================================================
+
+ProviderScanState::ProviderScanState(ClientContext &context, string name, const HttpSettings &settings,
+                                     const ProviderScanBindData &bind_data, provider_fetch_t fetch, idx_t batch_size)
+    : name(std::move(name)), settings(settings), bind_data(bind_data), fetch(fetch), next_fetch(0), fetched_rows(0),
+      cancelled(false), emit_batch(0), emit_chunk(0), emit_source_chunk(DConstants::INVALID_INDEX), emitted_chunks(0) {
+	// Requests of this scan's batches, stopped if the scan ends early
+	this->settings.cancellation = make_shared_ptr<RequestCancellation>();
+
+	// APIs that accept country lists get one request per batch instead of one per country
+	batch_size = MaxValue<idx_t>(batch_size, 1);
+	auto &countries = bind_data.countries;
+	if (bind_data.year_filter.IsEmpty()) {
+		// Contradictory year filters match no row: no batch, no request
+		return;
+	}
+	for (idx_t i = 0; i < countries.size(); i += batch_size) {
+		auto end = MinValue<idx_t>(i + batch_size, countries.size());
+		batches.emplace_back();
+		batches.back().countries.assign(countries.begin() + i, countries.begin() + end);
+		batches.back().rows = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), bind_data.types);
+	}
+}
+
+ProviderScanState::~ProviderScanState() {
+	// A scan can end early (LIMIT, error, interrupt): stop picking up batches, abort the requests in flight, wait
+	// for the running fetches to notice and drop the queued ones
+	cancelled = true;
+	settings.cancellation->Cancel();
+	sudan::IoPool::Instance().Cancel(this);
+}
+
+unique_ptr<GlobalTableFunctionState> ProviderScanState::Start(ClientContext &context, const string &name,
+                                                             const HttpSettings &settings,
+                                                             const ProviderScanBindData &bind_data,
+                                                             provider_fetch_t fetch, idx_t batch_size) {
+	auto global_state = make_uniq<ProviderScanState>(context, name, settings, bind_data, fetch, batch_size);
+
+	// Batches are independent requests, fetch them concurrently on the shared I/O pool rather than DuckDB worker
+	// threads. Each fetch queues the next one, so the scan keeps at most fetch_count batches in flight.
+	auto fetch_count = MinValue<idx_t>(global_state->batches.size(), MaxValue<idx_t>(settings.max_concurrency, 1));
+	if (bind_data.HasRowLimit()) {
+		// Any rows will do: fetch one batch at a time, the first ones usually satisfy the LIMIT on their own
+		fetch_count = MinValue<idx_t>(fetch_count, 1);
+	}
+	for (idx_t i = 0; i < fetch_count; i++) {
+		global_state->QueueFetch();
+	}
+	return std::move(global_state);
+}
+
+void ProviderScanState::QueueFetch() {
+	sudan::IoPool::Instance().Submit(this, [this]() {
+		if (FetchBatch()) {
+			QueueFetch();
+		}
+	});
+}
+
+bool ProviderScanState::FetchBatch() {
+	if (cancelled) {
+		return false;
+	}
+	if (bind_data.HasRowLimit() && fetched_rows >= bind_data.row_limit) {
+		// The LIMIT is satisfied: the remaining batches end empty instead of being requested
+		lock_guard<mutex> guard(lock);
+		for (auto batch_idx = next_fetch++; batch_idx < batches.size(); batch_idx = next_fetch++) {
+			batches[batch_idx].done = true;
+		}
+		batch_progress.notify_all();
+		return false;
+	}
+	auto batch_idx = next_fetch++;
+	if (batch_idx >= batches.size()) {
+		return false;
+	}
+	auto &batch = batches[batch_idx];
+
+	// Full chunks are published while the batch is still fetching, so Execute can emit them right away. Sorted
+	// batches are collected on the side and published once sorted.
+	unique_ptr<ColumnDataCollection> unsorted;
+	if (bind_data.sorted) {
+		unsorted = make_uniq<ColumnDataCollection>(*batch.rows);
+	}
+	ProviderRowWriter writer(bind_data.types, [this, &batch, &unsorted](DataChunk &chunk) {
+		if (unsorted) {
+			unsorted->Append(chunk);
+			return;
+		}
+		lock_guard<mutex> guard(lock);
+		batch.rows->Append(chunk);
+		batch_progress.notify_all();
+	});
+	bool complete = true;
+	std::exception_ptr batch_error;
+	try {
+		fetch(settings, bind_data, batch.countries, writer);
+	} catch (...) {
+		if (settings.DeadlineExpired()) {
+			// Keep the rows fetched before the deadline, NextChunk decides whether they are returned
+			complete = false;
+		} else {
+			batch_error = std::current_exception();
+		}
+	}
+	if (!batch_error) {
+		writer.Finish();
+	}
+	fetched_rows += writer.RowCount();
+	unique_ptr<ColumnDataCollection> sorted;
+	vector<SortedPiece> pieces;
+	if (unsorted && !batch_error) {
+		sorted = SortBatchRows(*unsorted, pieces);
+	}
+
+	lock_guard<mutex> guard(lock);
+	if (sorted) {
+		batch.rows = std::move(sorted);
+		batch.pieces = std::move(pieces);
+	}
+	if (batch_error && !error) {
+		error = batch_error;
+	}
+	batch.complete = complete;
+	batch.done = true;
+	batch_progress.notify_all();
+	return !cancelled;
+}
+
+unique_ptr<ColumnDataCollection> ProviderScanState::SortBatchRows(ColumnDataCollection &rows,
+                                                                  vector<SortedPiece> &pieces) const {
+	struct RowKey {
+		//! Binary sort keys of (country, year) and of the country alone, compared as bytes
+		string_t key;
+		string_t country;
+		idx_t chunk_idx;
+		sel_t row_idx;
+	};
+
+	// Ascending with NULLs last, the DuckDB default, so ORDER BY country, year over the scan needs no sort
+	vector<idx_t> key_columns;
+	if (bind_data.country_column != DConstants::INVALID_INDEX) {
+		key_columns.push_back(bind_data.country_column);
+	}
+	if (bind_data.year_column != DConstants::INVALID_INDEX) {
+		key_columns.push_back(bind_data.year_column);
+	}
+	vector<OrderModifiers> modifiers(key_columns.size(),
+	                                 OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
+
+	// Only the sort keys are held in memory, the rows stay in the buffer-managed collections. The key vectors own
+	// the key strings.
+	vector<RowKey> keys;
+	vector<unique_ptr<Vector>> key_vectors;
+	DataChunk chunk;
+	rows.InitializeScanChunk(chunk);
+	for (idx_t chunk_idx = 0; chunk_idx < rows.ChunkCount(); chunk_idx++) {
+		chunk.Reset();
+		rows.FetchChunk(chunk_idx, chunk);
+		string_t *full_keys = nullptr;
+		string_t *country_keys = nullptr;
+		if (!key_columns.empty()) {
+			DataChunk key_input;
+			vector<LogicalType> key_types;
+			for (auto col : key_columns) {
+				key_types.push_back(bind_data.types[col]);
+			}
+			key_input.InitializeEmpty(key_types);
+			for (idx_t i = 0; i < key_columns.size(); i++) {
+				key_input.data[i].Reference(chunk.data[key_columns[i]]);
+			}
+			key_input.SetCardinality(chunk);
+			key_vectors.push_back(make_uniq<Vector>(LogicalType::BLOB, chunk.size()));
+			CreateSortKeyHelpers::CreateSortKey(key_input, modifiers, *key_vectors.back());
+			full_keys = FlatVector::GetData<string_t>(*key_vectors.back());
+			country_keys = full_keys;
+		}
+		if (bind_data.country_column != DConstants::INVALID_INDEX && key_columns.size() > 1) {
+			key_vectors.push_back(make_uniq<Vector>(LogicalType::BLOB, chunk.size()));
+			CreateSortKeyHelpers::CreateSortKey(chunk.data[bind_data.country_column], chunk.size(), modifiers[0],
+			                                    *key_vectors.back());
+			country_keys = FlatVector::GetData<string_t>(*key_vectors.back());
+		}
+		for (idx_t row_idx = 0; row_idx < chunk.size(); row_idx++) {
+			RowKey key;
+			key.key = full_keys ? full_keys[row_idx] : string_t();
+			key.country =
+			    bind_data.country_column != DConstants::INVALID_INDEX ? country_keys[row_idx] : string_t();
+			key.chunk_idx = chunk_idx;
+			key.row_idx = UnsafeNumericCast<sel_t>(row_idx);
+			keys.push_back(key);
+		}
+	}
+	std::stable_sort(keys.begin(), keys.end(),
+	                 [](const RowKey &a, const RowKey &b) { return LessThan::Operation(a.key, b.key); });
+
+	// Copy runs of rows from the same source chunk at once into full chunks, so every chunk of the sorted collection
+	// is one appended chunk. A piece starts with every country and every chunk, so the scan can report each piece as
+	// a single-value partition of the country column.
+	auto sorted = make_uniq<ColumnDataCollection>(rows);
+	DataChunk output;
+	output.Initialize(Allocator::DefaultAllocator(), bind_data.types);
+	idx_t output_idx = 0;
+	idx_t source_idx = DConstants::INVALID_INDEX;
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t i = 0;
+	while (i < keys.size()) {
+		auto &first = keys[i];
+		if (first.chunk_idx != source_idx) {
+			chunk.Reset();
+			rows.FetchChunk(first.chunk_idx, chunk);
+			source_idx = first.chunk_idx;
+		}
+		if (output.size() == 0 || !Equals::Operation(keys[i - 1].country, first.country)) {
+			pieces.push_back(SortedPiece {output_idx, output.size(), 0});
+		}
+		idx_t run = 0;
+		while (i + run < keys.size() && output.size() + run < STANDARD_VECTOR_SIZE &&
+		       keys[i + run].chunk_idx == first.chunk_idx &&
+		       Equals::Operation(keys[i + run].country, first.country)) {
+			sel.set_index(run, keys[i + run].row_idx);
+			run++;
+		}
+		output.Append(chunk, false, &sel, run);
+		pieces.back().count += run;
+		i += run;
+		if (output.size() == STANDARD_VECTOR_SIZE) {
+			sorted->Append(output);
+			output.Reset();
+			output_idx++;
+		}
+	}
+	if (output.size() > 0) {
+		sorted->Append(output);
+	}
+	D_ASSERT(sorted->ChunkCount() == output_idx + (output.size() > 0 ? 1 : 0));
+	return sorted;
+}
+
+void ProviderScanState::DeadlineExpired(ClientContext &context, Batch &batch) {
+	// No new batches once the deadline is gone, they could only fail
+	cancelled = true;
+
+	auto countries = StringUtil::Join(batch.countries, ", ");
+	if (!settings.partial_results) {
+		throw IOException("SUDAN: %s exceeded the query deadline of %llus (sudan_query_timeout) while fetching %s. "
+		                  "SET sudan_partial_results = true to return the rows fetched so far.",
+		                  name, settings.query_timeout, countries);
+	}
+	SudanQueryState::Get(context)->AddWarning(
+	    name, StringUtil::Format("Query deadline of %llus expired, rows for %s are missing or incomplete.",
+	                             settings.query_timeout, countries));
+	batch.complete = true;
+}
+
+bool ProviderScanState::NextChunk(ClientContext &context, DataChunk &output) {
+	unique_lock<mutex> guard(lock);
+	while (emit_batch < batches.size()) {
+		auto &batch = batches[emit_batch];
+		while (!batch.done && emit_chunk >= batch.ChunkCount() && !error) {
+			auto now = std::chrono::steady_clock::now();
+			if (now >= settings.deadline) {
+				break;
+			}
+			// Wake up periodically so an interrupted query does not wait for the network
+			auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(settings.deadline - now);
+			batch_progress.wait_for(guard, MinValue(wait, std::chrono::milliseconds(100)));
+			if (context.interrupted) {
+				throw InterruptException();
+			}
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+		if (batch.done && !batch.complete) {
+			DeadlineExpired(context, batch);
+		}
+		// The writer appends whole chunks, so every chunk of the collection is complete once it exists
+		if (emit_chunk < batch.ChunkCount()) {
+			if (batch.pieces.empty()) {
+				batch.rows->FetchChunk(emit_chunk++, output);
+			} else {
+				auto &piece = batch.pieces[emit_chunk++];
+				if (piece.chunk_idx != emit_source_chunk) {
+					if (emit_source.ColumnCount() == 0) {
+						batch.rows->InitializeScanChunk(emit_source);
+					}
+					emit_source.Reset();
+					batch.rows->FetchChunk(piece.chunk_idx, emit_source);
+					emit_source_chunk = piece.chunk_idx;
+				}
+				emit_source.Copy(output, *FlatVector::IncrementalSelectionVector(), piece.offset + piece.count,
+				                 piece.offset);
+			}
+			emitted_chunks++;
+			if (bind_data.sorted && bind_data.country_column != DConstants::INVALID_INDEX) {
+				emit_country = output.GetValue(bind_data.country_column, 0);
+			}
+			return true;
+		}
+		if (!batch.done) {
+			// Still in flight at the deadline: skip the rest of it and emit the batches that did finish
+			DeadlineExpired(context, batch);
+			batch.rows->Reset();
+			batch.pieces.clear();
+			emit_source_chunk = DConstants::INVALID_INDEX;
+			emit_batch++;
+			emit_chunk = 0;
+			continue;
+		}
+		// Batch fully emitted, release its buffers and move on in batch order
+		batch.rows->Reset();
+		batch.pieces.clear();
+		emit_source_chunk = DConstants::INVALID_INDEX;
+		emit_batch++;
+		emit_chunk = 0;
+	}
+	return false;
+}
+
+OperatorPartitionData ProviderScanState::PartitionData(const OperatorPartitionInfo &partition_info) const {
+	OperatorPartitionData result(emitted_chunks);
+	for (idx_t i = 0; i < partition_info.partition_columns.size(); i++) {
+		result.partition_data.emplace_back(emit_country);
+	}
+	return result;
+}
+
+//======================================================================================================================
+// Helpers
+//======================================================================================================================
+
+// Remember a URL that failed or returned nothing, so reruns skip it for sudan_negative_cache_ttl seconds
+static void RememberMiss(const HttpSettings &settings, const string &url, const string &warning) {
+	if (settings.negative_cache_ttl > 0) {
+		sudan::ResponseCache::Instance().PutMiss(url, warning);
+	}
+}
+
+// Whether a recent request for the URL failed or returned nothing. The request is skipped, repeating its warning.
+static bool KnownMiss(const HttpSettings &settings, const string &url) {
+	if (settings.negative_cache_ttl == 0) {
+		return false;
+	}
+	string warning;
+	int64_t age_seconds = 0;
+	if (!sudan::ResponseCache::Instance().GetMiss(url, settings.negative_cache_ttl, warning, age_seconds)) {
+		return false;
+	}
+	if (!warning.empty()) {
+		settings.query_state->AddWarning(
+		    url, StringUtil::Format("%s (remembered from a request %llds ago)", warning, age_seconds));
+	}
+	return true;
+}
+
+// A request failed: throw if the query deadline cut it off, otherwise fall back to an expired cached response while
+// the provider is down. Returns false if there is nothing to serve, remembering the miss.
+static bool RecoverFailedFetch(const HttpSettings &settings, const string &url, const HttpResponseData &response,
+                               string &body) {
+	if (settings.DeadlineExpired()) {
+		// Not an empty result: abort the batch so the scan reports it as cut off by the deadline
+		throw IOException("SUDAN: Query deadline exceeded while fetching %s", url);
+	}
+	if (!response.IsHostFailure()) {
+		// 404s, other client errors and empty bodies: the same request will miss again
+		RememberMiss(settings, url, "");
+		return false;
+	}
+
+	// The provider is down or its circuit is open: an expired cached response beats no data
+	auto reason = response.error.empty() ? "HTTP " + to_string(response.status_code) : response.error;
+	int64_t age_seconds = 0;
+	body = sudan::ResponseCache::Instance().GetStale(url, age_seconds);
+	if (!body.empty()) {
+		settings.query_state->AddWarning(
+		    url, StringUtil::Format("%s. Served a cached response from %llds ago.", reason, age_seconds));
+		return true;
+	}
+	settings.query_state->AddWarning(url, reason);
+	if (!response.circuit_open) {
+		// An open circuit already fails fast, and must let the half-open probe through once it cools down
+		RememberMiss(settings, url, reason);
+	}
+	return false;
+}
+
+bool FetchCached(const HttpSettings &settings, const string &url, string &body) {
+	auto &cache = sudan::ResponseCache::Instance();
+	body = cache.Get(url);
+	if (!body.empty()) {
+		return true;
+	}
+	if (KnownMiss(settings, url)) {
+		return false;
+	}
+
+	auto response = HttpClient::Get(settings, url);
+	if (response.status_code != 200 || !response.error.empty() || response.body.empty()) {
+		return RecoverFailedFetch(settings, url, response, body);
+	}
+	body = std::move(response.body);
+	cache.Put(url, body);
+	return true;
+}
+
+// Streamed responses larger than this are not kept in the response cache, holding them would defeat streaming
+static constexpr idx_t MAX_STREAMED_CACHE_BYTES = 16 * 1024 * 1024;
+
+bool FetchStreamed(const HttpSettings &settings, const string &url, const string &array_key,
+                   const json_element_callback_t &on_element) {
+	auto on_text = [&](const char *text, size_t length) {
+		auto element_doc = yyjson_read(text, length, YYJSON_READ_NOFLAG);
+		if (!element_doc) {
+			return;
+		}
+		try {
+			on_element(yyjson_doc_get_root(element_doc));
+		} catch (...) {
+			yyjson_doc_free(element_doc);
+			throw;
+		}
+		yyjson_doc_free(element_doc);
+	};
+	auto replay = [&](const string &body) {
+		sudan::JsonArrayStream stream(array_key, on_text);
+		stream.Feed(body.data(), body.size());
+	};
+
+	auto &cache = sudan::ResponseCache::Instance();
+	auto body = cache.Get(url);
+	if (!body.empty()) {
+		replay(body);
+		return true;
+	}
+	if (KnownMiss(settings, url)) {
+		return false;
+	}
+
+	sudan::JsonArrayStream stream(array_key, on_text);
+	bool cacheable = true;
+	auto response = HttpClient::Get(settings, url, [&](const char *data, size_t size) {
+		if (cacheable && body.size() + size > MAX_STREAMED_CACHE_BYTES) {
+			cacheable = false;
+			string().swap(body);
+		}
+		if (cacheable) {
+			body.append(data, size);
+		}
+		return stream.Feed(data, size);
+	});
+
+	if (response.status_code == 200 && response.error.empty()) {
+		if (!stream.Complete()) {
+			if (stream.ElementCount() == 0) {
+				// No array under array_key: an error document or an empty body
+				RememberMiss(settings, url, "");
+				return false;
+			}
+			return true;
+		}
+		if (cacheable) {
+			cache.Put(url, body);
+		}
+		return true;
+	}
+
+	if (stream.ElementCount() > 0) {
+		// Rows are already out, a fallback would duplicate them
+		if (settings.DeadlineExpired()) {
+			throw IOException("SUDAN: Query deadline exceeded while fetching %s", url);
+		}
+		throw IOException("SUDAN: Response from %s broke off after %llu rows: %s", url,
+		                  static_cast<uint64_t>(stream.ElementCount()), response.error);
+	}
+	if (!RecoverFailedFetch(settings, url, response, body)) {
+		return false;
+	}
+	replay(body);
+	return true;
+}
+
+int32_t ParseYear(const char *str) {
+	try {
+		return std::stoi(str);
+	} catch (...) {
+		return 0;
+	}
+}
+
+void ProviderScanExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
+	auto &state = input.global_state->Cast<ProviderScanState>();
+	if (!state.NextChunk(context, output)) {
+		output.SetCardinality(0);
+	}
+}
+
+//======================================================================================================================
+// Partitioning
+//======================================================================================================================
+
+TablePartitionInfo ProviderScanGetPartitionInfo(ClientContext &context, TableFunctionPartitionInput &input) {
+	auto &bind_data = input.bind_data->Cast<ProviderScanBindData>();
+	if (!bind_data.sorted || bind_data.country_column == DConstants::INVALID_INDEX ||
+	    input.partition_ids.size() != 1 || input.partition_ids[0] != bind_data.country_column) {
+		return TablePartitionInfo::NOT_PARTITIONED;
+	}
+	// GROUP BY country can aggregate one country at a time instead of building a hash table
+	return TablePartitionInfo::SINGLE_VALUE_PARTITIONS;
+}
+
+OperatorPartitionData ProviderScanGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	auto &state = input.global_state->Cast<ProviderScanState>();
+	return state.PartitionData(input.partition_info);
+}
+
+void ProviderScanSetup(TableFunction &function) {
+	function.named_parameters["countries"] = LogicalType::LIST(LogicalType::VARCHAR);
+	function.named_parameters["sorted"] = LogicalType::BOOLEAN;
+	function.pushdown_complex_filter = ProviderScanPushdownFilter;
+	function.get_partition_info = ProviderScanGetPartitionInfo;
+	function.get_partition_data = ProviderScanGetPartitionData;
+	ScanOptimizer::EnableLimitPushdown(function);
+}
+
+//======================================================================================================================
+// Filter Pushdown
+//======================================================================================================================
+
+//! Narrow the year range with a single `year <op> constant` comparison. Bounds of 0 and below mean "unbounded" in
+//! the filter, so comparisons that would need one are left to the filter above the scan.
+static void ApplyYearComparison(ExpressionType type, int32_t year, sudan::FilterResult &filter) {
+	// Computed in 64 bits, `year > 2147483647` must not wrap around
+	auto value = static_cast<int64_t>(year);
+	bool has_start = true;
+	bool has_end = true;
+	int64_t start = value;
+	int64_t end = value;
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		start = value + 1;
+		has_end = false;
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		has_end = false;
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		end = value - 1;
+		has_start = false;
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		has_start = false;
+		break;
+	default:
+		return;
+	}
+	auto in_range = [](int64_t bound) {
+		return bound > 0 && bound <= NumericLimits<int32_t>::Maximum();
+	};
+	if ((has_start && !in_range(start)) || (has_end && !in_range(end))) {
+		return;
+	}
+	if (has_start) {
+		auto bound = UnsafeNumericCast<int32_t>(start);
+		filter.year_start = filter.year_start > 0 ? MaxValue(filter.year_start, bound) : bound;
+	}
+	if (has_end) {
+		auto bound = UnsafeNumericCast<int32_t>(end);
+		filter.year_end = filter.year_end > 0 ? MinValue(filter.year_end, bound) : bound;
+	}
+	filter.has_year_filter = true;
+}
+
+void ProviderScanPushdownFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<ProviderScanBindData>();
+	if (bind_data.year_column == DConstants::INVALID_INDEX) {
+		return;
+	}
+
+	auto &column_ids = get.GetColumnIds();
+	for (auto &filter : filters) {
+		if (filter->GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+			continue;
+		}
+		auto &comparison = filter->Cast<BoundComparisonExpression>();
+
+		// Accept both `year <op> constant` and `constant <op> year`
+		auto type = comparison.GetExpressionType();
+		optional_ptr<Expression> column_side = comparison.left.get();
+		optional_ptr<Expression> constant_side = comparison.right.get();
+		if (column_side->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			std::swap(column_side, constant_side);
+			type = FlipComparisonExpression(type);
+		}
+		if (column_side->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF ||
+		    constant_side->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+			continue;
+		}
+
+		auto &column_ref = column_side->Cast<BoundColumnRefExpression>();
+		if (column_ref.binding.table_index != get.table_index ||
+		    column_ref.binding.column_index >= column_ids.size() ||
+		    column_ids[column_ref.binding.column_index].GetPrimaryIndex() != bind_data.year_column) {
+			continue;
+		}
+
+		auto constant = constant_side->Cast<BoundConstantExpression>().value;
+		if (constant.IsNull() || !constant.DefaultTryCastAs(LogicalType::INTEGER)) {
+			continue;
+		}
+		auto year = IntegerValue::Get(constant);
+
+		// The filter itself stays in place: the API range only narrows what is downloaded
+		ApplyYearComparison(type, year, bind_data.year_filter);
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+
+#include "function_builder.hpp"
+#include "sudan/http_client.hpp"
+#include "sudan/filter_pushdown.hpp"
+#include "sudan/scan_optimizer.hpp"
+#include "yyjson.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+
+namespace duckdb {
+
+//======================================================================================================================
+// Provider Scan Framework
+//======================================================================================================================
+//
+// Every data provider (World Bank, WHO, FAO, UNHCR, ILO) is a table function with the same shape: positional
+// arguments, an optional `countries` list, a fixed column schema and one fetch per batch of countries. A provider
+// only describes itself through a scan descriptor:
+//
+//   struct MyProviderScan {
+//       static constexpr const char *NAME = "SUDAN_MyProvider";
+//       static constexpr const char *BASE_URL = "https://api.example.org";
+//       static constexpr idx_t ARGUMENT_COUNT = 1;
+//       static constexpr idx_t BATCH_SIZE = 20;  // countries per request, 1 if the API takes a single country
+//       static constexpr ProviderColumn COLUMNS[] = {{"year", LogicalTypeId::INTEGER}, ...};
+//       static constexpr auto DESCRIPTION = ...;
+//       static constexpr auto EXAMPLE = ...;
+//       static void CheckArguments(const vector<string> &args);
+//       static void Fetch(const HttpSettings &settings, const ProviderScanBindData &bind_data,
+//                         const vector<string> &countries, ProviderRowWriter &writer);
+//   };
+//
+// and ProviderScan<MyProviderScan> generates Bind/Init/Execute, year filter and limit pushdown, concurrent batched
+// fetching, optionally sorted (sorted := true) and vectorized output for it. Fetch may request fewer rows when bind_data has a row_limit
+// (see scan_optimizer.hpp); returning more than the limit is fine.
+
+//! An output column of a provider scan
+struct ProviderColumn {
+	const char *name;
+	LogicalTypeId type;
+};
+
+//! Bind data shared by all provider scans
+struct ProviderScanBindData : LimitedScanData {
+	//! Positional arguments (indicator, dataset/element, population type, ...)
+	vector<string> args;
+	//! Normalized ISO3 country codes, with groups expanded
+	vector<string> countries;
+	//! Output column types
+	vector<LogicalType> types;
+	//! Year range pushed down from the WHERE clause
+	sudan::FilterResult year_filter;
+	//! Index of the "country" column, or DConstants::INVALID_INDEX if there is none
+	idx_t country_column = DConstants::INVALID_INDEX;
+	//! Sort each batch by (country, year) and emit every country in chunks of its own (sorted := true)
+	bool sorted = false;
+
+	ProviderScanBindData(vector<string> args, vector<string> countries, vector<LogicalType> types, idx_t year_column);
+
+	//! Parse the `countries` named parameter, expanding '@GROUP' aliases and defaulting to Sudan
+	static vector<string> ParseCountries(const named_parameter_map_t &named_parameters);
+
+	//! Apply the `sorted` named parameter. If all countries are fetched in one batch of batch_size, the output is
+	//! declared sorted by (country, year) as a whole.
+	void ParseSorted(const named_parameter_map_t &named_parameters, idx_t batch_size);
+
+	//! Append a country code or '@GROUP' alias to a country list, skipping duplicates
+	static void AddCountries(const string &code, vector<string> &countries);
+
+	//! Resolve an ISO3, ISO2 or M49 code to ISO3. Throws InvalidInputException for unknown codes.
+	static string ResolveCountry(const string &code);
+};
+
+//! Receives each full chunk of a ProviderRowWriter. The chunk is reused for the next rows once the sink returns.
+typedef std::function<void(DataChunk &chunk)> provider_chunk_sink_t;
+
+//! Writes parsed rows straight into the vectors of a DataChunk, handing the chunk to a sink whenever it fills up
+class ProviderRowWriter {
+public:
+	ProviderRowWriter(const vector<LogicalType> &types, provider_chunk_sink_t sink);
+
+	//! Start a new row. All cells of the row are NULL until set.
+	void NewRow();
+
+	void SetString(idx_t col, const char *str);
+	void SetString(idx_t col, const string &str);
+	void SetInteger(idx_t col, int32_t value);
+	void SetBigint(idx_t col, int64_t value);
+	void SetDouble(idx_t col, double value);
+
+	//! Number of rows written so far
+	idx_t RowCount() const {
+		return row_count;
+	}
+
+	//! Hand the last, partially filled chunk to the sink
+	void Finish();
+
+private:
+	void FlushChunk();
+
+	const vector<LogicalType> &types;
+	provider_chunk_sink_t sink;
+	unique_ptr<DataChunk> chunk;
+	//! Row being written, or 0 with has_row false before the first row of a chunk
+	idx_t chunk_row;
+	bool has_row;
+	idx_t row_count;
+};
+
+//! Fetch callback of a provider: appends the rows for a batch of countries
+typedef void (*provider_fetch_t)(const HttpSettings &settings, const ProviderScanBindData &bind_data,
+                                 const vector<string> &countries, ProviderRowWriter &writer);
+
+//! Global scan state: fetches batches on the shared I/O pool and emits their chunks in batch order as soon as
+//! each chunk is filled, so Init never waits on the network and Execute only waits for the next chunk it emits
+class ProviderScanState final : public GlobalTableFunctionState {
+public:
+	ProviderScanState(ClientContext &context, string name, const HttpSettings &settings,
+	                  const ProviderScanBindData &bind_data, provider_fetch_t fetch, idx_t batch_size);
+	~ProviderScanState() override;
+
+	//! Output is emitted in order by a single thread; more threads would only wait on the same batch
+	idx_t MaxThreads() const override {
+		return 1;
+	}
+
+	//! Start fetching all countries of the scan in batches of batch_size, concurrently (bounded by
+	//! http_max_concurrency)
+	static unique_ptr<GlobalTableFunctionState> Start(ClientContext &context, const string &name,
+	                                                 const HttpSettings &settings,
+	                                                 const ProviderScanBindData &bind_data, provider_fetch_t fetch,
+	                                                 idx_t batch_size);
+
+	//! Read the next chunk in batch order into output, waiting for it to be filled if needed. Returns false at the end
+	//! of the scan. Batches cut off by the query deadline fail the scan, or are skipped with a warning in partial
+	//! results mode.
+	bool NextChunk(ClientContext &context, DataChunk &output);
+
+	//! Batch index and, for sorted scans, country of the chunk emitted last
+	OperatorPartitionData PartitionData(const OperatorPartitionInfo &partition_info) const;
+
+private:
+	//! Rows of a sorted batch emitted as one chunk: a run of a single country within a chunk of the collection
+	struct SortedPiece {
+		idx_t chunk_idx;
+		idx_t offset;
+		idx_t count;
+	};
+
+	struct Batch {
+		vector<string> countries;
+		//! Rows fetched so far, or all rows of a sorted batch once sorted. Allocated through the buffer manager, so
+		//! they count against memory_limit and can be spilled to temp storage while earlier batches are emitted.
+		unique_ptr<ColumnDataCollection> rows;
+		//! Chunks emitted from the rows of a sorted batch, one country each. The collection packs short countries
+		//! into one chunk.
+		vector<SortedPiece> pieces;
+		bool done = false;
+		//! False if the query deadline interrupted the batch
+		bool complete = true;
+
+		idx_t ChunkCount() const {
+			return pieces.empty() ? rows->ChunkCount() : pieces.size();
+		}
+	};
+
+	//! Queue the fetch of the next batch on the I/O pool
+	void QueueFetch();
+	//! Fetch the next batch, if any. Returns true if more batches may follow.
+	bool FetchBatch();
+	void DeadlineExpired(ClientContext &context, Batch &batch);
+	//! Copy the rows of a batch sorted by (country, year) into a new collection, split into pieces of a single
+	//! country each
+	unique_ptr<ColumnDataCollection> SortBatchRows(ColumnDataCollection &rows, vector<SortedPiece> &pieces) const;
+
+	//! Function name, for errors and warnings
+	string name;
+	HttpSettings settings;
+	const ProviderScanBindData &bind_data;
+	provider_fetch_t fetch;
+
+	vector<Batch> batches;
+	std::atomic<idx_t> next_fetch;
+	//! Rows fetched by all batches, to stop picking up batches once a pushed-down LIMIT is satisfied
+	std::atomic<idx_t> fetched_rows;
+	std::atomic<bool> cancelled;
+
+	//! Guards batches[*].rows/pieces/done and error
+	mutex lock;
+	//! Signalled when a batch fills a chunk or finishes
+	std::condition_variable batch_progress;
+	std::exception_ptr error;
+
+	//! Emit position, only touched by the executing thread
+	idx_t emit_batch;
+	idx_t emit_chunk;
+	//! Chunk of a sorted batch the current piece is copied from, fetched once for all its pieces
+	DataChunk emit_source;
+	idx_t emit_source_chunk;
+	//! Chunks emitted so far, and the country of the last one in sorted scans
+	idx_t emitted_chunks;
+	Value emit_country;
+};
+
+//! GET a URL through the session response cache. Returns false if the request failed, throws IOException if it
+//! failed because the query deadline expired. Failed and empty responses are remembered for
+//! sudan_negative_cache_ttl seconds, during which the URL is not requested again.
+bool FetchCached(const HttpSettings &settings, const string &url, string &body);
+
+//! Receives one element of a streamed JSON array, parsed as a document of its own
+typedef std::function<void(duckdb_yyjson::yyjson_val *element)> json_element_callback_t;
+
+//! GET a URL answering {..., "<array_key>": [...]} through the session response cache, handing each array element to
+//! on_element as soon as it has arrived, so parsing overlaps the download and only one element is held in memory.
+//! Returns false if the request failed before any element arrived (with the fallbacks of FetchCached), throws
+//! IOException if it broke off after some did.
+bool FetchStreamed(const HttpSettings &settings, const string &url, const string &array_key,
+                   const json_element_callback_t &on_element);
+
+//! Parse a string as an integer year, returning 0 if it is not a number
+int32_t ParseYear(const char *str);
+
+//! Emit the next fetched chunk of a provider scan
+void ProviderScanExecute(ClientContext &context, TableFunctionInput &input, DataChunk &output);
+
+//! Push year comparisons on the year column down into the provider request
+void ProviderScanPushdownFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data,
+                                vector<unique_ptr<Expression>> &filters);
+
+//! Sorted scans are partitioned by country: every chunk holds the rows of a single country
+TablePartitionInfo ProviderScanGetPartitionInfo(ClientContext &context, TableFunctionPartitionInput &input);
+
+OperatorPartitionData ProviderScanGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input);
+
+//! Declare the options and optimizer hooks shared by all provider scans on a table function
+void ProviderScanSetup(TableFunction &function);
+
+//======================================================================================================================
+// ProviderScan<SCAN>
+//======================================================================================================================
+
+template <class SCAN>
+struct ProviderScan {
+
+	static constexpr idx_t COLUMN_COUNT = sizeof(SCAN::COLUMNS) / sizeof(ProviderColumn);
+
+	static void BindColumns(vector<LogicalType> &return_types, vector<string> &names) {
+		for (idx_t i = 0; i < COLUMN_COUNT; i++) {
+			names.emplace_back(SCAN::COLUMNS[i].name);
+			return_types.emplace_back(SCAN::COLUMNS[i].type);
+		}
+	}
+
+	static idx_t FindColumn(const char *name) {
+		for (idx_t i = 0; i < COLUMN_COUNT; i++) {
+			if (string(SCAN::COLUMNS[i].name) == name) {
+				return i;
+			}
+		}
+		return DConstants::INVALID_INDEX;
+	}
+
+	static unique_ptr<ProviderScanBindData> CreateBindData(vector<string> args, vector<string> countries,
+	                                                       vector<LogicalType> &return_types, vector<string> &names) {
+		BindColumns(return_types, names);
+		auto bind_data = make_uniq<ProviderScanBindData>(std::move(args), std::move(countries), return_types,
+		                                                 FindColumn("year"));
+		bind_data->country_column = FindColumn("country");
+		return bind_data;
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Bind
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
+	                                     vector<LogicalType> &return_types, vector<string> &names) {
+		vector<string> args;
+		for (auto &arg : input.inputs) {
+			args.push_back(StringValue::Get(arg));
+		}
+		SCAN::CheckArguments(args);
+
+		auto countries = ProviderScanBindData::ParseCountries(input.named_parameters);
+		auto bind_data = CreateBindData(std::move(args), std::move(countries), return_types, names);
+		bind_data->ParseSorted(input.named_parameters, SCAN::BATCH_SIZE);
+		return std::move(bind_data);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Init
+	//------------------------------------------------------------------------------------------------------------------
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<ProviderScanBindData>();
+
+		HttpSettings settings = HttpClient::ExtractHttpSettings(context, SCAN::BASE_URL);
+
+		return ProviderScanState::Start(context, SCAN::NAME, settings, bind_data, SCAN::Fetch, SCAN::BATCH_SIZE);
+	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Register
+	//------------------------------------------------------------------------------------------------------------------
+
+	static TableFunction GetFunction() {
+		vector<LogicalType> arguments;
+		for (idx_t i = 0; i < SCAN::ARGUMENT_COUNT; i++) {
+			arguments.push_back(LogicalType::VARCHAR);
+		}
+		TableFunction func(SCAN::NAME, arguments, ProviderScanExecute, Bind, Init);
+		ProviderScanSetup(func);
+		return func;
+	}
+
+	//! Create a scan with pre-bound arguments (used by the ATTACH catalog)
+	static TableFunction GetCatalogScan(vector<string> args, const vector<string> &countries,
+	                                    vector<LogicalType> &return_types, vector<string> &names,
+	                                    unique_ptr<FunctionData> &bind_data) {
+		bind_data = CreateBindData(std::move(args), countries, return_types, names);
+		return GetFunction();
+	}
+
+	static void Register(ExtensionLoader &loader) {
+
+		InsertionOrderPreservingMap<string> tags;
+		tags.insert("ext", "sudan");
+		tags.insert("category", "table");
+
+		auto func = GetFunction();
+
+		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, SCAN::DESCRIPTION,
+		                                SCAN::EXAMPLE, tags);
+	}
+};
+
+} // namespace duckdb
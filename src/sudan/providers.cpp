@@ -1,36 +1,128 @@
 #include "providers.hpp"
+#include "countries_data.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace sudan {
 
+//======================================================================================================================
+// Perfect Hash Lookup
+//======================================================================================================================
+
+static constexpr uint32_t FNV_OFFSET = 2166136261u;
+static constexpr uint32_t FNV_PRIME = 16777619u;
+
+//! FNV-1a over a country code with a seeded offset basis (must match scripts/generate_countries.py)
+static constexpr uint32_t CountryCodeHash(const char *code, uint32_t hash) {
+	return *code ? CountryCodeHash(code + 1, (hash ^ static_cast<uint8_t>(*code)) * FNV_PRIME) : hash;
+}
+
+//! Slot of a key: the first hash picks a bucket, the bucket displacement seeds the second hash
+static constexpr uint32_t PerfectHashSlot(const uint16_t *displacements, const char *key) {
+	return CountryCodeHash(key, FNV_OFFSET ^ displacements[CountryCodeHash(key, FNV_OFFSET) % COUNTRY_HASH_BUCKETS]) %
+	       COUNTRY_HASH_SLOTS;
+}
+
+// The generated tables and the C++ hash must agree, checked at compile time
+static_assert(COUNTRIES[ISO3_SLOTS[PerfectHashSlot(ISO3_DISPLACEMENTS, "SDN")]].m49 == 729,
+              "countries_data.hpp is out of sync with CountryCodeHash, regenerate it");
+static_assert(COUNTRIES[ISO2_SLOTS[PerfectHashSlot(ISO2_DISPLACEMENTS, "SS")]].m49 == 728,
+              "countries_data.hpp is out of sync with CountryCodeHash, regenerate it");
+
+static const CountryInfo *LookupCountry(const uint16_t *displacements, const uint16_t *slots, const char *key) {
+	auto index = slots[PerfectHashSlot(displacements, key)];
+	if (index == COUNTRY_HASH_EMPTY) {
+		return nullptr;
+	}
+	return &COUNTRIES[index];
+}
+
+//======================================================================================================================
+// Countries
+//======================================================================================================================
+
 const CountryInfo *FindCountryByISO3(const std::string &iso3) {
-	for (const auto &country : SUPPORTED_COUNTRIES) {
-		if (country.iso3 == iso3) {
-			return &country;
+	if (iso3.size() != 3) {
+		return nullptr;
+	}
+	auto country = LookupCountry(ISO3_DISPLACEMENTS, ISO3_SLOTS, iso3.c_str());
+	return country && iso3 == country->iso3 ? country : nullptr;
+}
+
+const CountryInfo *FindCountry(const std::string &code) {
+	if (code.empty() || code.size() > 3) {
+		return nullptr;
+	}
+
+	// Numeric M49 codes are zero-padded to three digits, letter codes upper-cased
+	char key[4] = {'0', '0', '0', '\0'};
+	auto all_digits = std::all_of(code.begin(), code.end(), [](char c) { return c >= '0' && c <= '9'; });
+	if (all_digits) {
+		memcpy(key + 3 - code.size(), code.c_str(), code.size());
+		auto country = LookupCountry(M49_DISPLACEMENTS, M49_SLOTS, key);
+		return country && country->m49 == std::stoi(key) ? country : nullptr;
+	}
+	if (code.size() == 1) {
+		return nullptr;
+	}
+	for (size_t i = 0; i < code.size(); i++) {
+		key[i] = static_cast<char>(toupper(static_cast<unsigned char>(code[i])));
+	}
+	key[code.size()] = '\0';
+
+	if (code.size() == 2) {
+		auto country = LookupCountry(ISO2_DISPLACEMENTS, ISO2_SLOTS, key);
+		return country && strcmp(country->iso2, key) == 0 ? country : nullptr;
+	}
+	auto country = LookupCountry(ISO3_DISPLACEMENTS, ISO3_SLOTS, key);
+	return country && strcmp(country->iso3, key) == 0 ? country : nullptr;
+}
+
+size_t CountryCount() {
+	return sizeof(COUNTRIES) / sizeof(CountryInfo);
+}
+
+const CountryInfo &GetCountry(size_t index) {
+	return COUNTRIES[index];
+}
+
+//======================================================================================================================
+// Country Groups
+//======================================================================================================================
+
+const CountryGroup *FindCountryGroup(const std::string &name) {
+	auto group_name = !name.empty() && name[0] == '@' ? name.substr(1) : name;
+	for (const auto &group : COUNTRY_GROUPS) {
+		if (group_name.size() == strlen(group.name) &&
+		    std::equal(group_name.begin(), group_name.end(), group.name,
+		               [](char a, char b) { return toupper(static_cast<unsigned char>(a)) == b; })) {
+			return &group;
 		}
 	}
 	return nullptr;
 }
 
-const Provider *FindProvider(const std::string &id) {
-	for (const auto &provider : PROVIDERS) {
-		if (provider.id == id) {
-			return &provider;
+size_t CountryGroupCount() {
+	return sizeof(COUNTRY_GROUPS) / sizeof(CountryGroup);
+}
+
+const CountryGroup &GetCountryGroup(size_t index) {
+	return COUNTRY_GROUPS[index];
+}
+
+std::vector<std::string> GetGroupMembers(const CountryGroup &group) {
+	std::vector<std::string> members;
+	for (const auto &country : COUNTRIES) {
+		if (country.groups & group.mask) {
+			members.emplace_back(country.iso3);
 		}
 	}
-	return nullptr;
+	return members;
 }
 
 bool ValidateCountryCodes(const std::vector<std::string> &codes) {
 	for (const auto &code : codes) {
-		bool found = false;
-		for (const auto &country : SUPPORTED_COUNTRIES) {
-			if (country.iso3 == code || country.iso2 == code) {
-				found = true;
-				break;
-			}
-		}
-		if (!found) {
+		if (!FindCountry(code)) {
 			return false;
 		}
 	}
@@ -38,15 +130,29 @@ bool ValidateCountryCodes(const std::vector<std::string> &codes) {
 }
 
 std::string NormalizeCountryCode(const std::string &code) {
-	for (const auto &country : SUPPORTED_COUNTRIES) {
-		if (country.iso3 == code) {
-			return country.iso3;
-		}
-		if (country.iso2 == code) {
-			return country.iso3;
+	auto country = FindCountry(code);
+	return country ? country->iso3 : code;
+}
+
+std::string GetFAOAreaCode(const std::string &iso3) {
+	auto country = FindCountryByISO3(iso3);
+	if (!country || country->fao_area == 0) {
+		return "";
+	}
+	return std::to_string(country->fao_area);
+}
+
+//======================================================================================================================
+// Providers
+//======================================================================================================================
+
+const Provider *FindProvider(const std::string &id) {
+	for (const auto &provider : PROVIDERS) {
+		if (provider.id == id) {
+			return &provider;
 		}
 	}
-	return code;
+	return nullptr;
 }
 
 } // namespace sudan
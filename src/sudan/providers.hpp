@@ -17,25 +17,22 @@ struct Provider {
 	std::string country_param; // "SDN", "SD", or "Sudan" depending on API
 };
 
-//! Supported country info (Sudan + neighbors)
+//! ISO 3166-1 country info. The full table lives in countries_data.hpp.
 struct CountryInfo {
-	std::string iso3;    // "SDN"
-	std::string iso2;    // "SD"
-	std::string name;    // "Sudan"
-	std::string name_ar; // Arabic name
+	const char *iso3;    // "SDN"
+	const char *iso2;    // "SD"
+	uint16_t m49;        // 729 (UN M49 / ISO 3166 numeric)
+	uint16_t fao_area;   // 276 (FAOSTAT area code, 0 if FAOSTAT does not publish the territory)
+	uint8_t groups;      // Bit set of CountryGroup::mask the country belongs to
+	const char *name;    // "Sudan"
+	const char *name_ar; // Arabic name
 };
 
-//! Supported countries: Sudan + neighbors
-static const std::vector<CountryInfo> SUPPORTED_COUNTRIES = {
-    {"SDN", "SD", "Sudan", "\xd8\xa7\xd9\x84\xd8\xb3\xd9\x88\xd8\xaf\xd8\xa7\xd9\x86"},
-    {"EGY", "EG", "Egypt", "\xd9\x85\xd8\xb5\xd8\xb1"},
-    {"ETH", "ET", "Ethiopia", "\xd8\xa5\xd8\xab\xd9\x8a\xd9\x88\xd8\xa8\xd9\x8a\xd8\xa7"},
-    {"TCD", "TD", "Chad", "\xd8\xaa\xd8\xb4\xd8\xa7\xd8\xaf"},
-    {"SSD", "SS", "South Sudan", "\xd8\xac\xd9\x86\xd9\x88\xd8\xa8 \xd8\xa7\xd9\x84\xd8\xb3\xd9\x88\xd8\xaf\xd8\xa7\xd9\x86"},
-    {"ERI", "ER", "Eritrea", "\xd8\xa5\xd8\xb1\xd9\x8a\xd8\xaa\xd8\xb1\xd9\x8a\xd8\xa7"},
-    {"LBY", "LY", "Libya", "\xd9\x84\xd9\x8a\xd8\xa8\xd9\x8a\xd8\xa7"},
-    {"CAF", "CF", "Central African Republic",
-     "\xd8\xac\xd9\x85\xd9\x87\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9 \xd8\xa3\xd9\x81\xd8\xb1\xd9\x8a\xd9\x82\xd9\x8a\xd8\xa7 \xd8\xa7\xd9\x84\xd9\x88\xd8\xb3\xd8\xb7\xd9\x89"},
+//! Named country group, referenced as `countries := ['@IGAD']`
+struct CountryGroup {
+	const char *name; // "IGAD"
+	uint8_t mask;     // Bit of the group in CountryInfo::groups
+	const char *description;
 };
 
 //! API Providers
@@ -62,16 +59,40 @@ static const std::vector<Provider> PROVIDERS = {
      "https://sdmx.ilo.org/rest/", "SDN"},
 };
 
-//! Lookup a country by ISO3 code
+//! Lookup a country by ISO3 code (exact, upper case). O(1) perfect hash lookup.
 const CountryInfo *FindCountryByISO3(const std::string &iso3);
 
+//! Lookup a country by ISO3, ISO2 or M49 numeric code (case-insensitive). Returns nullptr if unknown.
+const CountryInfo *FindCountry(const std::string &code);
+
+//! Number of countries in the ISO 3166-1 table
+size_t CountryCount();
+
+//! Get a country of the ISO 3166-1 table by index
+const CountryInfo &GetCountry(size_t index);
+
 //! Lookup a provider by ID
 const Provider *FindProvider(const std::string &id);
 
+//! Lookup a country group by name (case-insensitive, with or without the leading '@'). Returns nullptr if unknown.
+const CountryGroup *FindCountryGroup(const std::string &name);
+
+//! Number of country groups
+size_t CountryGroupCount();
+
+//! Get a country group by index
+const CountryGroup &GetCountryGroup(size_t index);
+
+//! ISO3 codes of the members of a group, in table order
+std::vector<std::string> GetGroupMembers(const CountryGroup &group);
+
 //! Validate a list of country codes, returns true if all valid
 bool ValidateCountryCodes(const std::vector<std::string> &codes);
 
-//! Get the ISO3 code for a given ISO2 or ISO3 code
+//! Get the ISO3 code for a given ISO2, ISO3 or M49 code. Unknown codes are returned unchanged.
 std::string NormalizeCountryCode(const std::string &code);
 
+//! Get the FAOSTAT area code for an ISO3 code, or an empty string if FAOSTAT has none
+std::string GetFAOAreaCode(const std::string &iso3);
+
 } // namespace sudan
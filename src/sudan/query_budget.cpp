@@ -0,0 +1,171 @@
+#include "query_budget.hpp"
+
+#include <atomic>
+
+// DuckDB
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+
+// SUDAN
+#include "sudan/cache.hpp"
+#include "sudan/request_scheduler.hpp"
+
+namespace duckdb {
+
+//======================================================================================================================
+// SudanQueryState
+//======================================================================================================================
+
+// Ids are never reused, unlike the address of a closed connection's context
+static std::atomic<uint64_t> next_session_id {1};
+
+SudanQueryState::SudanQueryState()
+    : session_id_(next_session_id++), query_start_(std::chrono::steady_clock::now()), query_id_(0),
+      warnings_query_id_(0) {
+}
+
+void SudanQueryState::QueryBegin(ClientContext &context) {
+	std::lock_guard<std::mutex> guard(mutex_);
+	query_start_ = std::chrono::steady_clock::now();
+	query_id_++;
+}
+
+std::chrono::steady_clock::time_point SudanQueryState::QueryStart() {
+	std::lock_guard<std::mutex> guard(mutex_);
+	return query_start_;
+}
+
+void SudanQueryState::AddWarning(const string &source, const string &message) {
+	std::lock_guard<std::mutex> guard(mutex_);
+	if (warnings_query_id_ != query_id_) {
+		warnings_.clear();
+		warnings_query_id_ = query_id_;
+	}
+	warnings_.emplace_back(source, message);
+}
+
+vector<pair<string, string>> SudanQueryState::Warnings() {
+	std::lock_guard<std::mutex> guard(mutex_);
+	return warnings_;
+}
+
+shared_ptr<SudanQueryState> SudanQueryState::Get(ClientContext &context) {
+	// Created lazily by the first scan of a connection; later queries reset it through QueryBegin
+	return context.registered_state->GetOrCreate<SudanQueryState>("sudan_query_state");
+}
+
+//======================================================================================================================
+// Settings
+//======================================================================================================================
+
+// The cache is shared by all connections, so the last SET wins for all of them
+static void SetCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	auto megabytes = UBigIntValue::Get(parameter);
+	// Larger values would wrap around when converted to bytes, possibly to 0, emptying the cache
+	if (megabytes > (NumericLimits<uint64_t>::Maximum() >> 20)) {
+		throw InvalidInputException("SUDAN: sudan_cache_size must be at most %llu megabytes, got %llu",
+		                            NumericLimits<uint64_t>::Maximum() >> 20, megabytes);
+	}
+	sudan::ResponseCache::Instance().SetCapacity(megabytes << 20);
+}
+
+static void CheckPriority(ClientContext &context, SetScope scope, Value &parameter) {
+	sudan::RequestPriority priority;
+	if (!sudan::RequestScheduler::ParsePriority(StringValue::Get(parameter), priority)) {
+		throw InvalidInputException("SUDAN: sudan_priority must be 'interactive' or 'background', got '%s'",
+		                            StringValue::Get(parameter));
+	}
+}
+
+static void CheckHttp2(ClientContext &context, SetScope scope, Value &parameter) {
+#ifndef SUDAN_ENABLE_HTTP2
+	if (BooleanValue::Get(parameter)) {
+		throw InvalidInputException("SUDAN: sudan_http2 is not available, the extension was built without "
+		                            "SUDAN_ENABLE_HTTP2 (libcurl with nghttp2)");
+	}
+#endif
+}
+
+static void CheckSessionWeight(ClientContext &context, SetScope scope, Value &parameter) {
+	auto weight = DoubleValue::Get(parameter);
+	if (!(weight > 0)) {
+		throw InvalidInputException("SUDAN: sudan_session_weight must be positive, got %s", parameter.ToString());
+	}
+}
+
+static void CheckHedgeBudget(ClientContext &context, SetScope scope, Value &parameter) {
+	auto budget = DoubleValue::Get(parameter);
+	if (!(budget >= 0 && budget <= 100)) {
+		throw InvalidInputException("SUDAN: sudan_hedge_budget must be between 0 and 100, got %s",
+		                            parameter.ToString());
+	}
+}
+
+void QueryBudget::Register(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+
+	config.AddExtensionOption("sudan_query_timeout",
+	                          "Total seconds a query may spend fetching from data providers (0 = no deadline)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("sudan_connect_timeout",
+	                          "Seconds to establish a connection to a data provider (0 = use http_timeout)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("sudan_first_byte_timeout",
+	                          "Seconds until a data provider sends its response headers (0 = use http_timeout)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("sudan_read_timeout",
+	                          "Seconds to read a data provider response body (0 = use http_timeout)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("sudan_partial_results",
+	                          "Return the rows fetched before sudan_query_timeout expires, with warnings listed by "
+	                          "SUDAN_Warnings(), instead of failing the query",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("sudan_hedge_requests",
+	                          "Send a duplicate of a provider GET still running after the host's p95 latency and use "
+	                          "the first response",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("sudan_hedge_budget", "Maximum percentage of a host's requests that may be hedged",
+	                          LogicalType::DOUBLE, Value::DOUBLE(5.0), CheckHedgeBudget);
+	config.AddExtensionOption("sudan_breaker_threshold",
+	                          "Consecutive failures after which requests to a provider host fail fast (0 = never)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(5));
+	config.AddExtensionOption("sudan_breaker_cooldown",
+	                          "Seconds an open circuit fails fast before a probe request is let through",
+	                          LogicalType::UBIGINT, Value::UBIGINT(30));
+	config.AddExtensionOption("sudan_http2",
+	                          "Multiplex data provider GET requests over one HTTP/2 connection per host",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false), CheckHttp2);
+	config.AddExtensionOption("sudan_dns_cache_ttl",
+	                          "Seconds a resolved data provider address is reused for new connections (0 = no cache)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(300));
+	config.AddExtensionOption("sudan_negative_cache_ttl",
+	                          "Seconds a failed, empty or 404 provider response is remembered instead of requested "
+	                          "again (0 = no negative cache)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(60));
+	config.AddExtensionOption("sudan_cache_size",
+	                          "Megabytes of provider responses kept by the response cache shared by all connections",
+	                          LogicalType::UBIGINT, Value::UBIGINT(sudan::ResponseCache::DEFAULT_CAPACITY >> 20),
+	                          SetCacheSize);
+	config.AddExtensionOption("sudan_priority",
+	                          "Priority of the connection's provider requests: 'interactive' requests go first, "
+	                          "'background' requests (warming, sync, exports) yield to them",
+	                          LogicalType::VARCHAR, Value("interactive"), CheckPriority);
+	config.AddExtensionOption("sudan_host_concurrency",
+	                          "Provider requests that may run against one host at once over all connections "
+	                          "(0 = no limit)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(16));
+	config.AddExtensionOption("sudan_session_weight",
+	                          "Share of a busy provider host given to this connection's requests, relative to other "
+	                          "connections",
+	                          LogicalType::DOUBLE, Value::DOUBLE(1.0), CheckSessionWeight);
+	config.AddExtensionOption("sudan_session_quota",
+	                          "Provider requests this connection may run at once over all hosts (0 = no limit)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("sudan_catalog_listing",
+	                          "List every indicator of the World Bank and WHO schemas of an attached sudan catalog, "
+	                          "downloading their indicator catalogs, instead of only the tables looked up so far",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+}
+
+} // namespace duckdb
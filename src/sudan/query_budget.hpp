@@ -0,0 +1,78 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/main/client_context_state.hpp"
+
+#include <chrono>
+#include <mutex>
+
+namespace duckdb {
+
+class ExtensionLoader;
+
+//======================================================================================================================
+// Query Budget
+//======================================================================================================================
+//
+// Remote scans are bounded per query rather than per request:
+//
+//   sudan_query_timeout       total seconds a query may spend fetching (0 = no deadline)
+//   sudan_connect_timeout     seconds to establish a connection        (0 = http_timeout)
+//   sudan_first_byte_timeout  seconds until the response headers arrive (0 = http_timeout)
+//   sudan_read_timeout        seconds to read a response body           (0 = http_timeout)
+//   sudan_partial_results     return the rows fetched before the deadline, with warnings, instead of failing
+//   sudan_hedge_requests      duplicate GETs still running after the host's p95 latency (tail latency hedging)
+//   sudan_hedge_budget        maximum percentage of a host's requests that may be hedged
+//   sudan_breaker_threshold   consecutive failures that open a host's circuit breaker (0 = never)
+//   sudan_breaker_cooldown    seconds an open circuit fails fast before a half-open probe
+//   sudan_http2               multiplex GETs to a host over one HTTP/2 connection
+//   sudan_dns_cache_ttl       seconds a resolved provider address is reused (0 = no cache)
+//   sudan_negative_cache_ttl  seconds a failed, empty or 404 response is remembered (0 = no negative cache)
+//   sudan_cache_size          megabytes of responses kept by the shared response cache
+//   sudan_priority            'interactive' or 'background': background requests yield to interactive ones
+//   sudan_host_concurrency    requests that may run against one host at once over all connections (0 = no limit)
+//   sudan_session_weight      share of a busy host given to the connection, relative to other connections
+//   sudan_session_quota       requests the connection may run at once over all hosts (0 = no limit)
+//   sudan_catalog_listing     list every World Bank and WHO indicator of an attached catalog, downloading the catalogs
+//
+// Warnings of the most recent query that produced any are listed by SUDAN_Warnings().
+
+//! Per-connection state: start of the running query and the warnings it produced
+class SudanQueryState : public ClientContextState {
+public:
+	SudanQueryState();
+
+	void QueryBegin(ClientContext &context) override;
+
+	//! Start of the running query, the origin of its deadline
+	std::chrono::steady_clock::time_point QueryStart();
+
+	//! Record a warning for the running query, replacing the warnings of earlier queries
+	void AddWarning(const string &source, const string &message);
+
+	//! Warnings of the most recent query that produced any, as (source, message) pairs
+	vector<pair<string, string>> Warnings();
+
+	//! Id of the connection, unique for the life of the process: the session of its requests in the RequestScheduler
+	uint64_t SessionId() const {
+		return session_id_;
+	}
+
+	static shared_ptr<SudanQueryState> Get(ClientContext &context);
+
+private:
+	const uint64_t session_id_;
+	std::mutex mutex_;
+	std::chrono::steady_clock::time_point query_start_;
+	idx_t query_id_;
+	idx_t warnings_query_id_;
+	vector<pair<string, string>> warnings_;
+};
+
+struct QueryBudget {
+public:
+	//! Register the sudan_* timeout, deadline, hedging, circuit breaker, transport and cache settings
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
@@ -0,0 +1,202 @@
+#include "request_scheduler.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace sudan {
+
+uint64_t RequestScheduler::ReservedSlots(uint64_t slots) {
+	// A quarter of the slots, and at least one as soon as there are two
+	return slots < 2 ? 0 : std::max<uint64_t>(slots / 4, 1);
+}
+
+bool RequestScheduler::WithinQuota(const RequestTicket &ticket) const {
+	if (ticket.quota == 0) {
+		return true;
+	}
+	auto it = session_running_.find(ticket.session);
+	return it == session_running_.end() || it->second < ticket.quota;
+}
+
+const RequestScheduler::Waiter *RequestScheduler::Next(const HostState &state) const {
+	if (state.interactive_running + state.background_running >= state.slots) {
+		return nullptr;
+	}
+	const Waiter *next_interactive = nullptr;
+	const Waiter *next_background = nullptr;
+	for (auto &waiter : state.waiting) {
+		// A session at its quota must not hold up the others
+		if (!WithinQuota(waiter.ticket)) {
+			continue;
+		}
+		auto &next = waiter.ticket.priority == RequestPriority::INTERACTIVE ? next_interactive : next_background;
+		if (!next || waiter.tag < next->tag) {
+			next = &waiter;
+		}
+	}
+	if (next_interactive) {
+		return next_interactive;
+	}
+	if (next_background && state.background_running < state.background_limit) {
+		return next_background;
+	}
+	return nullptr;
+}
+
+bool RequestScheduler::Acquire(const std::string &host, const RequestTicket &ticket, uint64_t slots,
+                               std::chrono::steady_clock::time_point deadline, const std::atomic<bool> *cancelled) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	// The slot count is a setting and may change between queries
+	slots = std::max<uint64_t>(slots, 1);
+	if (state.slots != slots) {
+		state.slots = slots;
+		auto unreserved = slots - ReservedSlots(slots);
+		state.background_limit = state.background_limit == 0 ? unreserved : std::min(state.background_limit, unreserved);
+		state.background_limit = std::max<uint64_t>(state.background_limit, 1);
+		slot_freed_.notify_all();
+	}
+
+	// Tag the request: a session that queues many requests at once pushes its own tags out, not the others'
+	auto &session_tag = state.session_tags[ticket.session];
+	Waiter waiter;
+	waiter.ticket = ticket;
+	waiter.tag = std::max(state.virtual_time, session_tag) + 1.0 / std::max(ticket.weight, 1e-6);
+	session_tag = waiter.tag;
+	auto position = state.waiting.insert(state.waiting.end(), waiter);
+
+	auto is_cancelled = [&]() {
+		return cancelled && cancelled->load();
+	};
+	auto can_start = [&]() {
+		return is_cancelled() || Next(state) == &*position;
+	};
+	if (deadline == std::chrono::steady_clock::time_point::max()) {
+		slot_freed_.wait(lock, can_start);
+	} else {
+		slot_freed_.wait_until(lock, deadline, can_start);
+	}
+	bool acquired = !is_cancelled() && Next(state) == &*position;
+	state.waiting.erase(position);
+	// Either way the next waiter may go now: another free slot, or the place this one held in the queue
+	slot_freed_.notify_all();
+	if (!acquired) {
+		// The request never ran: unless more of the session's requests are queued here, forget its tag so the
+		// session's next request is not pushed back for it
+		bool session_waiting = false;
+		for (auto &other : state.waiting) {
+			session_waiting = session_waiting || other.ticket.session == ticket.session;
+		}
+		if (!session_waiting) {
+			state.session_tags.erase(ticket.session);
+		}
+		return false;
+	}
+
+	state.virtual_time = std::max(state.virtual_time, waiter.tag);
+	if (ticket.priority == RequestPriority::INTERACTIVE) {
+		state.interactive_running++;
+	} else {
+		state.background_running++;
+	}
+	session_running_[ticket.session]++;
+	return true;
+}
+
+void RequestScheduler::Release(const std::string &host, const RequestTicket &ticket, uint64_t latency_ms) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto &state = hosts_[host];
+	auto unreserved = state.slots - ReservedSlots(state.slots);
+
+	if (ticket.priority == RequestPriority::INTERACTIVE) {
+		state.interactive_running--;
+		if (latency_ms > 0) {
+			auto latency = static_cast<double>(latency_ms);
+			if (state.interactive_latency_ms == 0) {
+				state.interactive_latency_ms = latency;
+				state.baseline_latency_ms = latency;
+			} else {
+				state.interactive_latency_ms += LATENCY_ALPHA * (latency - state.interactive_latency_ms);
+				// The baseline follows slowly and never chases a spike upwards
+				state.baseline_latency_ms += BASELINE_ALPHA * (std::min(state.interactive_latency_ms, latency) -
+				                                               state.baseline_latency_ms);
+			}
+			if (state.interactive_latency_ms > PRESSURE_FACTOR * state.baseline_latency_ms) {
+				// Interactive requests slow down: back off background work multiplicatively
+				state.background_limit = std::max<uint64_t>(state.background_limit / 2, 1);
+			}
+		}
+	} else {
+		state.background_running--;
+		bool pressure = state.interactive_latency_ms > PRESSURE_FACTOR * state.baseline_latency_ms;
+		if (latency_ms > 0 && !pressure && state.background_limit < unreserved) {
+			state.background_limit++;
+		}
+	}
+
+	// Sessions that went idle: their tags are behind the virtual time and no longer matter
+	auto tag = state.session_tags.find(ticket.session);
+	if (tag != state.session_tags.end() && tag->second <= state.virtual_time) {
+		state.session_tags.erase(tag);
+	}
+	auto running = session_running_.find(ticket.session);
+	if (running != session_running_.end() && --running->second == 0) {
+		session_running_.erase(running);
+	}
+	slot_freed_.notify_all();
+}
+
+void RequestScheduler::WakeWaiters() {
+	// Taking the lock orders the wake-up after the flag was set, so no waiter misses it between check and wait
+	std::lock_guard<std::mutex> lock(mutex_);
+	slot_freed_.notify_all();
+}
+
+RequestScheduler::HostStats RequestScheduler::GetStats(const std::string &host) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	HostStats stats;
+	auto it = hosts_.find(host);
+	if (it == hosts_.end()) {
+		return stats;
+	}
+	auto &state = it->second;
+	stats.interactive_running = state.interactive_running;
+	stats.background_running = state.background_running;
+	stats.waiting = state.waiting.size();
+	stats.background_limit = state.background_limit;
+	stats.interactive_latency_ms = state.interactive_latency_ms;
+	stats.baseline_latency_ms = state.baseline_latency_ms;
+	return stats;
+}
+
+uint64_t RequestScheduler::SessionRunning(uint64_t session) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	auto it = session_running_.find(session);
+	return it == session_running_.end() ? 0 : it->second;
+}
+
+const char *RequestScheduler::PriorityName(RequestPriority priority) {
+	return priority == RequestPriority::INTERACTIVE ? "interactive" : "background";
+}
+
+bool RequestScheduler::ParsePriority(const std::string &name, RequestPriority &priority) {
+	std::string lower = name;
+	std::transform(lower.begin(), lower.end(), lower.begin(),
+	               [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	if (lower == "interactive") {
+		priority = RequestPriority::INTERACTIVE;
+		return true;
+	}
+	if (lower == "background") {
+		priority = RequestPriority::BACKGROUND;
+		return true;
+	}
+	return false;
+}
+
+RequestScheduler &RequestScheduler::Instance() {
+	static RequestScheduler instance;
+	return instance;
+}
+
+} // namespace sudan
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace sudan {
+
+//! Priority class of a request: dashboards and ad-hoc queries are interactive, warming, sync and export jobs are
+//! background work
+enum class RequestPriority : uint8_t { INTERACTIVE, BACKGROUND };
+
+//! Who asks for a request slot: the priority class, the session (connection) and its share
+struct RequestTicket {
+	RequestPriority priority = RequestPriority::INTERACTIVE;
+	//! Opaque session key, the same for all requests of a connection
+	uint64_t session = 0;
+	//! Share of a contended host relative to other sessions (> 0)
+	double weight = 1.0;
+	//! Requests the session may run at once over all hosts (0 = no limit)
+	uint64_t quota = 0;
+};
+
+//! Per-host request slots shared by all connections, like the response cache.
+//!
+//! At most `slots` requests run against a host at once. Interactive requests take any free slot and are served
+//! before waiting background requests. Background requests never take the slots reserved for interactive work, and
+//! their share shrinks while interactive latency rises above its baseline (halved on pressure, grown back one slot
+//! per healthy background request), so warm-up jobs yield to user-facing queries instead of competing with them.
+//!
+//! Within a priority class, waiting requests are served by weighted fair queuing over sessions (self-clocked: each
+//! request is tagged with its session's previous tag, or the host's virtual time if later, plus 1 / weight, and the
+//! smallest tag goes first). A session queuing 50 countries at once gets its share of the host, not the whole queue.
+//! A session at its quota waits without blocking the others.
+class RequestScheduler {
+public:
+	//! Wait for a slot to the host until the deadline, or until *cancelled is set (if given). Returns false if the
+	//! deadline passed or the request was cancelled first.
+	bool Acquire(const std::string &host, const RequestTicket &ticket, uint64_t slots,
+	             std::chrono::steady_clock::time_point deadline, const std::atomic<bool> *cancelled = nullptr);
+
+	//! Wake up waiting requests to check their cancellation flags
+	void WakeWaiters();
+
+	//! Return a slot, reporting the latency of the request (0 if it failed)
+	void Release(const std::string &host, const RequestTicket &ticket, uint64_t latency_ms);
+
+	struct HostStats {
+		uint64_t interactive_running = 0;
+		uint64_t background_running = 0;
+		uint64_t waiting = 0;
+		//! Slots background requests may use right now
+		uint64_t background_limit = 0;
+		//! Smoothed and baseline interactive latency in milliseconds
+		double interactive_latency_ms = 0;
+		double baseline_latency_ms = 0;
+	};
+
+	HostStats GetStats(const std::string &host);
+
+	//! Requests the session is running over all hosts
+	uint64_t SessionRunning(uint64_t session);
+
+	static const char *PriorityName(RequestPriority priority);
+
+	//! Parse 'interactive' or 'background' (case-insensitive). Returns false for anything else.
+	static bool ParsePriority(const std::string &name, RequestPriority &priority);
+
+	static RequestScheduler &Instance();
+
+private:
+	struct Waiter {
+		RequestTicket ticket;
+		//! Virtual finish time: waiters with smaller tags go first
+		double tag;
+	};
+
+	struct HostState {
+		uint64_t slots = 0;
+		uint64_t interactive_running = 0;
+		uint64_t background_running = 0;
+		//! Background share, between 1 and the unreserved slots; 0 until the host is first used
+		uint64_t background_limit = 0;
+		double interactive_latency_ms = 0;
+		double baseline_latency_ms = 0;
+		//! Waiting requests in arrival order, so equal tags are served first come, first served
+		std::list<Waiter> waiting;
+		//! Tag of the last request started, and of the last request queued by each session
+		double virtual_time = 0;
+		std::unordered_map<uint64_t, double> session_tags;
+	};
+
+	//! Slots kept free for interactive requests
+	static uint64_t ReservedSlots(uint64_t slots);
+	bool WithinQuota(const RequestTicket &ticket) const;
+	//! The waiter to start next, nullptr if none can start
+	const Waiter *Next(const HostState &state) const;
+
+	std::unordered_map<std::string, HostState> hosts_;
+	//! Running requests per session over all hosts, for the quotas
+	std::unordered_map<uint64_t, uint64_t> session_running_;
+	std::mutex mutex_;
+	//! Signalled whenever a waiter may be able to start. One for all hosts: a session's release on one host can
+	//! unblock it on another.
+	std::condition_variable slot_freed_;
+
+	//! Weight of a new sample in the smoothed latency, and of the smoothed latency in the slow baseline
+	static constexpr double LATENCY_ALPHA = 0.2;
+	static constexpr double BASELINE_ALPHA = 0.02;
+	//! Interactive latency above this multiple of the baseline counts as pressure
+	static constexpr double PRESSURE_FACTOR = 1.5;
+};
+
+} // namespace sudan
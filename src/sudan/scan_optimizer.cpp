@@ -0,0 +1,156 @@
+#include "scan_optimizer.hpp"
+
+// DuckDB
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/extension/extension_loader.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_limit.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+//! Marks the table functions whose scans accept pushed-down limits and declare their output order
+struct LimitPushdownInfo final : public TableFunctionInfo {
+	static shared_ptr<TableFunctionInfo> &Get() {
+		static shared_ptr<TableFunctionInfo> info = make_shared_ptr<LimitPushdownInfo>();
+		return info;
+	}
+};
+
+// Limits beyond this are as good as none, and adding the offset must not overflow
+static constexpr idx_t MAX_PUSHED_LIMIT = 1000000000;
+
+void ScanOptimizer::EnableLimitPushdown(TableFunction &function) {
+	function.function_info = LimitPushdownInfo::Get();
+}
+
+//======================================================================================================================
+// Plan Rewrite
+//======================================================================================================================
+
+// The limit-aware scan directly below op, looking through projections
+static optional_ptr<LogicalGet> FindLimitedScan(LogicalOperator &op) {
+	auto current = &op;
+	while (current->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		current = current->children[0].get();
+	}
+	if (current->type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = current->Cast<LogicalGet>();
+	if (!get.bind_data || get.function.function_info != LimitPushdownInfo::Get()) {
+		return nullptr;
+	}
+	return &get;
+}
+
+// Whether an expression above op is the given column of the scan, following the binding down through projections
+static bool IsScanColumn(const Expression &expr, LogicalOperator &op, LogicalGet &get, idx_t column) {
+	if (column == DConstants::INVALID_INDEX || expr.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return false;
+	}
+	auto binding = expr.Cast<BoundColumnRefExpression>().binding;
+	auto current = &op;
+	while (current->type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = current->Cast<LogicalProjection>();
+		if (binding.table_index != projection.table_index || binding.column_index >= projection.expressions.size()) {
+			return false;
+		}
+		auto &projected = *projection.expressions[binding.column_index];
+		if (projected.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return false;
+		}
+		binding = projected.Cast<BoundColumnRefExpression>().binding;
+		current = current->children[0].get();
+	}
+	auto &column_ids = get.GetColumnIds();
+	return binding.table_index == get.table_index && binding.column_index < column_ids.size() &&
+	       column_ids[binding.column_index].GetPrimaryIndex() == column;
+}
+
+// Whether the scan output below op already has the order of the ORDER BY
+static bool SatisfiesOrder(LogicalOrder &order_by, LogicalGet &get) {
+	auto &output_order = get.bind_data->Cast<LimitedScanData>().output_order;
+	if (order_by.orders.empty() || order_by.orders.size() > output_order.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < order_by.orders.size(); i++) {
+		auto &order = order_by.orders[i];
+		if (order.type != OrderType::ASCENDING || order.null_order != OrderByNullType::NULLS_LAST ||
+		    !IsScanColumn(*order.expression, *order_by.children[0], get, output_order[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void RewritePlan(ClientContext &context, unique_ptr<LogicalOperator> &op_ptr) {
+	auto &op = *op_ptr;
+	if (op.type == LogicalOperatorType::LOGICAL_ORDER_BY) {
+		// The ORDER BY can only go if the rows keep the scan order on their way up. One that also projects away
+		// columns is kept, its child has different column bindings.
+		auto &order_by = op.Cast<LogicalOrder>();
+		auto get = FindLimitedScan(*op.children[0]);
+		if (get && !order_by.HasProjectionMap() && DBConfig::GetConfig(context).options.preserve_insertion_order &&
+		    SatisfiesOrder(order_by, *get)) {
+			op_ptr = std::move(op.children[0]);
+			RewritePlan(context, op_ptr);
+			return;
+		}
+	} else if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
+		auto &limit = op.Cast<LogicalLimit>();
+		auto get = FindLimitedScan(*op.children[0]);
+		auto offset_type = limit.offset_val.Type();
+		if (get && limit.limit_val.Type() == LimitNodeType::CONSTANT_VALUE &&
+		    (offset_type == LimitNodeType::UNSET || offset_type == LimitNodeType::CONSTANT_VALUE)) {
+			auto rows = limit.limit_val.GetConstantValue();
+			auto offset = offset_type == LimitNodeType::UNSET ? 0 : limit.offset_val.GetConstantValue();
+			if (rows > 0 && rows <= MAX_PUSHED_LIMIT && offset <= MAX_PUSHED_LIMIT) {
+				auto &data = get->bind_data->Cast<LimitedScanData>();
+				data.row_limit = rows + offset;
+				data.year_order = ScanYearOrder::ANY;
+			}
+		}
+	} else if (op.type == LogicalOperatorType::LOGICAL_TOP_N) {
+		// Only a sort on the year alone: among rows of the same year the scan keeps arbitrary ones, which would not
+		// be the first ones by a second sort key
+		auto &top_n = op.Cast<LogicalTopN>();
+		auto get = FindLimitedScan(*op.children[0]);
+		if (get && top_n.orders.size() == 1 && top_n.limit > 0 && top_n.limit <= MAX_PUSHED_LIMIT &&
+		    top_n.offset <= MAX_PUSHED_LIMIT) {
+			auto &data = get->bind_data->Cast<LimitedScanData>();
+			auto &order = top_n.orders[0];
+			if (IsScanColumn(*order.expression, *op.children[0], *get, data.year_column) &&
+			    (order.type == OrderType::ASCENDING || order.type == OrderType::DESCENDING)) {
+				data.row_limit = top_n.limit + top_n.offset;
+				data.year_order =
+				    order.type == OrderType::DESCENDING ? ScanYearOrder::DESCENDING : ScanYearOrder::ASCENDING;
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		RewritePlan(context, child);
+	}
+}
+
+static void OptimizeScans(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	RewritePlan(input.context, plan);
+}
+
+//======================================================================================================================
+// Register
+//======================================================================================================================
+
+void ScanOptimizer::Register(ExtensionLoader &loader) {
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+
+	OptimizerExtension extension;
+	extension.optimize_function = OptimizeScans;
+	config.optimizer_extensions.push_back(std::move(extension));
+}
+
+} // namespace duckdb
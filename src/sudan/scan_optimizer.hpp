@@ -0,0 +1,56 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+
+namespace duckdb {
+
+class ExtensionLoader;
+
+//======================================================================================================================
+// Scan Optimizer
+//======================================================================================================================
+//
+// DuckDB does not hand LIMIT or ORDER BY ... LIMIT to table functions, so an optimizer extension pushes them into the
+// bind data of the scans that opt in:
+//
+//   SELECT * FROM SUDAN_UNHCR('refugees') LIMIT 20                          row_limit = 20
+//   SELECT * FROM SUDAN_WHO('WHOSIS_000001') ORDER BY year DESC LIMIT 5     row_limit = 5, year_order = DESCENDING
+//
+// Only an ORDER BY on the year column alone is pushed. The LIMIT / TOP N operator stays in the plan: a scan may
+// return more rows than the limit, but never fewer than the query needs. Limits above a filter are not pushed, the
+// filter could discard any number of rows.
+//
+// Scans that declare their output order also lose ORDER BY clauses they already satisfy:
+//
+//   SELECT * FROM SUDAN_WHO('WHOSIS_000001', sorted := true) ORDER BY country, year     no sort
+
+enum class ScanYearOrder : uint8_t { ANY, ASCENDING, DESCENDING };
+
+//! Bind data of a scan that can stop fetching once the query has the rows it needs, and may declare its output order
+struct LimitedScanData : public TableFunctionData {
+	//! The query reads at most this many rows (LIMIT + OFFSET), 0 if it reads all of them
+	idx_t row_limit = 0;
+	//! With a row_limit: ANY if any rows will do, otherwise the query keeps the first rows in this year order
+	ScanYearOrder year_order = ScanYearOrder::ANY;
+	//! Index of the "year" column, or DConstants::INVALID_INDEX if there is none
+	idx_t year_column = DConstants::INVALID_INDEX;
+	//! Columns the output is guaranteed to be sorted by (ascending, NULLs last), empty if the order is unknown
+	vector<idx_t> output_order;
+
+	//! Whether only the first row_limit rows in any order are needed
+	bool HasRowLimit() const {
+		return row_limit > 0 && year_order == ScanYearOrder::ANY;
+	}
+};
+
+struct ScanOptimizer {
+	//! Let the optimizer push limits into scans of the function and elide sorts over them. Its bind data must derive
+	//! from LimitedScanData.
+	static void EnableLimitPushdown(TableFunction &function);
+
+	//! Register the optimizer extension
+	static void Register(ExtensionLoader &loader);
+};
+
+} // namespace duckdb
@@ -0,0 +1,319 @@
+#include "series_kernels.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+namespace sudan {
+
+//======================================================================================================================
+// Gap filling
+//======================================================================================================================
+
+bool ParseFillMethod(const std::string &name, FillMethod &method) {
+	std::string lower = name;
+	std::transform(lower.begin(), lower.end(), lower.begin(),
+	               [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	if (lower == "linear") {
+		method = FillMethod::LINEAR;
+	} else if (lower == "locf") {
+		method = FillMethod::LOCF;
+	} else if (lower == "spline") {
+		method = FillMethod::SPLINE;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+void FilledSeries::Clear() {
+	source.clear();
+	years.clear();
+	values.clear();
+	valid.clear();
+	filled.clear();
+}
+
+// Second derivatives of the natural cubic spline through the points (zero at both ends), by the Thomas algorithm
+static std::vector<double> SplineCurvature(const std::vector<double> &xs, const std::vector<double> &ys) {
+	auto n = xs.size();
+	std::vector<double> curvature(n, 0.0);
+	if (n < 3) {
+		return curvature;
+	}
+	std::vector<double> diagonal(n, 0.0);
+	std::vector<double> rhs(n, 0.0);
+	for (size_t k = 1; k + 1 < n; k++) {
+		auto h_prev = xs[k] - xs[k - 1];
+		auto h_next = xs[k + 1] - xs[k];
+		diagonal[k] = 2 * (h_prev + h_next);
+		rhs[k] = 6 * ((ys[k + 1] - ys[k]) / h_next - (ys[k] - ys[k - 1]) / h_prev);
+	}
+	// Forward elimination of the sub-diagonal (h_prev), then back substitution of the super-diagonal (h_next)
+	for (size_t k = 2; k + 1 < n; k++) {
+		auto factor = (xs[k] - xs[k - 1]) / diagonal[k - 1];
+		diagonal[k] -= factor * (xs[k] - xs[k - 1]);
+		rhs[k] -= factor * rhs[k - 1];
+	}
+	for (size_t k = n - 2; k >= 1; k--) {
+		curvature[k] = (rhs[k] - (xs[k + 1] - xs[k]) * curvature[k + 1]) / diagonal[k];
+	}
+	return curvature;
+}
+
+void FillSeries(const int64_t *years, const double *values, const uint8_t *valid, size_t count, size_t source_offset,
+                FillMethod method, FilledSeries &out) {
+	if (count == 0) {
+		return;
+	}
+
+	// Rows of the input, with the years missing between them as NULL rows
+	auto begin = out.Size();
+	for (size_t i = 0; i < count; i++) {
+		out.source.push_back(source_offset + i);
+		out.years.push_back(years[i]);
+		out.values.push_back(valid[i] ? values[i] : 0.0);
+		out.valid.push_back(valid[i]);
+		out.filled.push_back(0);
+		auto next_year = i + 1 < count ? years[i + 1] : years[i] + 1;
+		for (auto year = years[i] + 1; year < next_year; year++) {
+			out.source.push_back(source_offset + i);
+			out.years.push_back(year);
+			out.values.push_back(0.0);
+			out.valid.push_back(0);
+			out.filled.push_back(0);
+		}
+	}
+	auto end = out.Size();
+
+	// Observations the gaps are estimated from
+	std::vector<size_t> known;
+	for (auto i = begin; i < end; i++) {
+		if (out.valid[i]) {
+			known.push_back(i);
+		}
+	}
+	if (known.empty()) {
+		return;
+	}
+
+	if (method == FillMethod::LOCF) {
+		for (auto i = known.front() + 1; i < end; i++) {
+			if (!out.valid[i]) {
+				out.values[i] = out.values[i - 1];
+				out.valid[i] = 1;
+				out.filled[i] = 1;
+			}
+		}
+		return;
+	}
+
+	// Linear and spline estimates only fill gaps between two observations
+	std::vector<double> curvature;
+	if (method == FillMethod::SPLINE && known.size() >= 3) {
+		std::vector<double> xs, ys;
+		for (auto i : known) {
+			xs.push_back(static_cast<double>(out.years[i]));
+			ys.push_back(out.values[i]);
+		}
+		curvature = SplineCurvature(xs, ys);
+	}
+	for (size_t k = 0; k + 1 < known.size(); k++) {
+		auto left = known[k];
+		auto right = known[k + 1];
+		auto x0 = static_cast<double>(out.years[left]);
+		auto x1 = static_cast<double>(out.years[right]);
+		auto y0 = out.values[left];
+		auto y1 = out.values[right];
+		auto h = x1 - x0;
+		for (auto i = left + 1; i < right; i++) {
+			auto x = static_cast<double>(out.years[i]);
+			double estimate;
+			if (curvature.empty()) {
+				estimate = y0 + (y1 - y0) * (x - x0) / h;
+			} else {
+				auto m0 = curvature[k];
+				auto m1 = curvature[k + 1];
+				estimate = m0 * (x1 - x) * (x1 - x) * (x1 - x) / (6 * h) + m1 * (x - x0) * (x - x0) * (x - x0) / (6 * h) +
+				           (y0 / h - m0 * h / 6) * (x1 - x) + (y1 / h - m1 * h / 6) * (x - x0);
+			}
+			out.values[i] = estimate;
+			out.valid[i] = 1;
+			out.filled[i] = 1;
+		}
+	}
+}
+
+//======================================================================================================================
+// Growth and rebasing
+//======================================================================================================================
+
+void SeriesEndpoints::Initialize() {
+	has_value = false;
+	first_year = last_year = 0;
+	first_value = last_value = 0;
+}
+
+void SeriesEndpoints::Add(int64_t year, double value) {
+	if (!has_value) {
+		has_value = true;
+		first_year = last_year = year;
+		first_value = last_value = value;
+		return;
+	}
+	if (year < first_year) {
+		first_year = year;
+		first_value = value;
+	}
+	if (year > last_year) {
+		last_year = year;
+		last_value = value;
+	}
+}
+
+void SeriesEndpoints::Merge(const SeriesEndpoints &other) {
+	if (other.has_value) {
+		Add(other.first_year, other.first_value);
+		Add(other.last_year, other.last_value);
+	}
+}
+
+bool SeriesEndpoints::CompoundGrowth(double &rate) const {
+	if (!has_value || last_year == first_year || first_value <= 0 || last_value <= 0) {
+		return false;
+	}
+	rate = std::pow(last_value / first_value, 1.0 / static_cast<double>(last_year - first_year)) - 1;
+	return true;
+}
+
+void SeriesLatestPair::Initialize() {
+	count = 0;
+	years[0] = years[1] = 0;
+	values[0] = values[1] = 0;
+}
+
+void SeriesLatestPair::Add(int64_t year, double value) {
+	// years[0] is the latest year, years[1] the one before
+	if (count > 0 && year == years[0]) {
+		return;
+	}
+	if (count == 0 || year > years[0]) {
+		years[1] = years[0];
+		values[1] = values[0];
+		years[0] = year;
+		values[0] = value;
+		count = count == 0 ? 1 : 2;
+	} else if (count == 1 || year > years[1]) {
+		years[1] = year;
+		values[1] = value;
+		count = 2;
+	}
+}
+
+void SeriesLatestPair::Merge(const SeriesLatestPair &other) {
+	for (uint8_t i = 0; i < other.count; i++) {
+		Add(other.years[i], other.values[i]);
+	}
+}
+
+bool SeriesLatestPair::YearOverYear(double &rate) const {
+	if (count < 2 || years[1] != years[0] - 1 || values[1] == 0) {
+		return false;
+	}
+	rate = values[0] / values[1] - 1;
+	return true;
+}
+
+void SeriesRebase::Initialize() {
+	has_base = has_value = false;
+	base_value = last_value = 0;
+	last_year = 0;
+}
+
+void SeriesRebase::Add(int64_t year, double value, int64_t base_year) {
+	if (year == base_year && !has_base) {
+		has_base = true;
+		base_value = value;
+	}
+	if (!has_value || year > last_year) {
+		has_value = true;
+		last_year = year;
+		last_value = value;
+	}
+}
+
+void SeriesRebase::Merge(const SeriesRebase &other) {
+	if (other.has_base && !has_base) {
+		has_base = true;
+		base_value = other.base_value;
+	}
+	if (other.has_value && (!has_value || other.last_year > last_year)) {
+		has_value = true;
+		last_year = other.last_year;
+		last_value = other.last_value;
+	}
+}
+
+bool SeriesRebase::Index(double &index) const {
+	if (!has_base || !has_value || base_value == 0) {
+		return false;
+	}
+	index = 100 * last_value / base_value;
+	return true;
+}
+
+//======================================================================================================================
+// Trend
+//======================================================================================================================
+
+void TrendState::Initialize() {
+	count = mean_x = mean_y = m2_x = m2_y = c_xy = 0;
+	last_year = 0;
+}
+
+void TrendState::Add(int64_t year, double value) {
+	auto x = static_cast<double>(year);
+	last_year = count == 0 ? year : std::max(last_year, year);
+	count += 1;
+	auto dx = x - mean_x;
+	auto dy = value - mean_y;
+	mean_x += dx / count;
+	mean_y += dy / count;
+	m2_x += dx * (x - mean_x);
+	m2_y += dy * (value - mean_y);
+	c_xy += dx * (value - mean_y);
+}
+
+void TrendState::Merge(const TrendState &other) {
+	if (other.count == 0) {
+		return;
+	}
+	if (count == 0) {
+		*this = other;
+		return;
+	}
+	auto total = count + other.count;
+	auto dx = other.mean_x - mean_x;
+	auto dy = other.mean_y - mean_y;
+	auto weight = count * other.count / total;
+	m2_x += other.m2_x + dx * dx * weight;
+	m2_y += other.m2_y + dy * dy * weight;
+	c_xy += other.c_xy + dx * dy * weight;
+	mean_x += dx * other.count / total;
+	mean_y += dy * other.count / total;
+	count = total;
+	last_year = std::max(last_year, other.last_year);
+}
+
+bool TrendState::Fit(TrendFit &fit) const {
+	if (count < 2 || m2_x <= 0) {
+		return false;
+	}
+	fit.slope = c_xy / m2_x;
+	fit.intercept = mean_y - fit.slope * mean_x;
+	// A flat series is fitted exactly
+	fit.r2 = m2_y > 0 ? std::min(1.0, c_xy * c_xy / (m2_x * m2_y)) : 1.0;
+	return true;
+}
+
+} // namespace sudan
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sudan {
+
+//======================================================================================================================
+// Gap filling
+//======================================================================================================================
+
+//! How SUDAN_Fill estimates missing values: straight line between the neighbouring observations, last observation
+//! carried forward, or a natural cubic spline through all observations of the series
+enum class FillMethod : uint8_t { LINEAR, LOCF, SPLINE };
+
+//! Parse 'linear', 'locf' or 'spline' (case-insensitive). Returns false for anything else.
+bool ParseFillMethod(const std::string &name, FillMethod &method);
+
+//! Filled series in struct-of-arrays form, appended series after series so callers emit whole vectors at once
+struct FilledSeries {
+	//! Input row each output row comes from: the row of its year, or the preceding row for a year the input lacks
+	std::vector<size_t> source;
+	std::vector<int64_t> years;
+	std::vector<double> values;
+	std::vector<uint8_t> valid;
+	//! Whether the value was estimated rather than observed
+	std::vector<uint8_t> filled;
+
+	size_t Size() const {
+		return years.size();
+	}
+
+	void Clear();
+};
+
+//! Fill the gaps of one annual series: NULL values, and years missing between its first and last year. years must be
+//! strictly increasing. Rows are appended to out with source = source_offset + input row. Values before the first
+//! observation, and after the last one except with LOCF, stay NULL.
+void FillSeries(const int64_t *years, const double *values, const uint8_t *valid, size_t count, size_t source_offset,
+                FillMethod method, FilledSeries &out);
+
+//======================================================================================================================
+// Growth and rebasing
+//======================================================================================================================
+//
+// Aggregate states over (year, value) observations. Each is a few scalars that merge in any order, so the aggregates
+// run in parallel and over window segment trees. Observations of a year already held keep the value seen first.
+
+//! Earliest and latest observation: compound annual growth rate between them
+struct SeriesEndpoints {
+	bool has_value;
+	int64_t first_year;
+	double first_value;
+	int64_t last_year;
+	double last_value;
+
+	void Initialize();
+	void Add(int64_t year, double value);
+	void Merge(const SeriesEndpoints &other);
+	//! (last / first) ^ (1 / years) - 1. False without two years or with non-positive endpoints.
+	bool CompoundGrowth(double &rate) const;
+};
+
+//! Latest two observations: growth of the latest year over the year before
+struct SeriesLatestPair {
+	uint8_t count;
+	int64_t years[2];
+	double values[2];
+
+	void Initialize();
+	void Add(int64_t year, double value);
+	void Merge(const SeriesLatestPair &other);
+	//! latest / previous - 1. False unless the two latest years are consecutive and the previous value is not 0.
+	bool YearOverYear(double &rate) const;
+};
+
+//! Value of the base year and latest observation: index of the latest year with the base year at 100
+struct SeriesRebase {
+	bool has_base;
+	double base_value;
+	bool has_value;
+	int64_t last_year;
+	double last_value;
+
+	void Initialize();
+	void Add(int64_t year, double value, int64_t base_year);
+	void Merge(const SeriesRebase &other);
+	//! 100 * latest / base. False without a base year observation or with a base value of 0.
+	bool Index(double &index) const;
+};
+
+//======================================================================================================================
+// Trend
+//======================================================================================================================
+
+//! Least squares line through a series
+struct TrendFit {
+	double slope;
+	double intercept;
+	double r2;
+};
+
+//! Running moments of (year, value) for a least squares trend. Means and co-moments rather than raw sums, so years
+//! around 2000 do not cancel out the variance; states merge with the pairwise update of Chan et al.
+struct TrendState {
+	double count;
+	double mean_x;
+	double mean_y;
+	double m2_x;
+	double m2_y;
+	double c_xy;
+	int64_t last_year;
+
+	void Initialize();
+	void Add(int64_t year, double value);
+	void Merge(const TrendState &other);
+	//! False with fewer than two distinct years
+	bool Fit(TrendFit &fit) const;
+};
+
+} // namespace sudan
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+
 namespace duckdb {
 
 class ExtensionLoader;
@@ -7,6 +10,14 @@ class ExtensionLoader;
 struct UNHCRFunctions {
 public:
 	static void Register(ExtensionLoader &loader);
+
+	//! Create a SUDAN_UNHCR scan over a single population type (used by the ATTACH catalog)
+	static TableFunction GetCatalogScan(const string &population_type, const vector<string> &countries,
+	                                    vector<LogicalType> &return_types, vector<string> &names,
+	                                    unique_ptr<FunctionData> &bind_data);
+
+	//! List the population types exposed as tables by the ATTACH catalog
+	static vector<string> ListPopulationTypes(ClientContext &context);
 };
 
 } // namespace duckdb
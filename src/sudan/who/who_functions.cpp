@@ -11,9 +11,7 @@
 using namespace duckdb_yyjson; // NOLINT
 
 // SUDAN
-#include "sudan/providers.hpp"
-#include "sudan/http_client.hpp"
-#include "sudan/filter_pushdown.hpp"
+#include "sudan/provider_scan.hpp"
 #include "sudan/cache.hpp"
 
 namespace duckdb {
@@ -24,232 +22,103 @@ namespace {
 // SUDAN_WHO
 //======================================================================================================================
 
-struct SudanWHO {
-
-	struct DataRow {
-		string indicator_code;
-		string indicator_name;
-		string country;
-		int32_t year;
-		string sex;
-		double value;
-		bool has_value;
-		string region;
+struct WHOScan {
+
+	static constexpr const char *NAME = "SUDAN_WHO";
+	static constexpr const char *BASE_URL = "https://ghoapi.azureedge.net";
+	static constexpr idx_t ARGUMENT_COUNT = 1;
+	//! Countries are OR-ed in one OData filter
+	static constexpr idx_t BATCH_SIZE = 25;
+
+	static constexpr ProviderColumn COLUMNS[] = {
+	    {"indicator_code", LogicalTypeId::VARCHAR}, {"indicator_name", LogicalTypeId::VARCHAR},
+	    {"country", LogicalTypeId::VARCHAR},        {"year", LogicalTypeId::INTEGER},
+	    {"sex", LogicalTypeId::VARCHAR},            {"value", LogicalTypeId::DOUBLE},
+	    {"region", LogicalTypeId::VARCHAR},
 	};
 
 	//------------------------------------------------------------------------------------------------------------------
 	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData final : TableFunctionData {
-		string indicator;
-		std::vector<string> countries;
-
-		explicit BindData(const string &indicator, const std::vector<string> &countries)
-		    : indicator(indicator), countries(std::move(countries)) {
-		}
-	};
-
-	static unique_ptr<FunctionData> Bind(ClientContext &context, TableFunctionBindInput &input,
-	                                     vector<LogicalType> &return_types, vector<string> &names) {
-
-		D_ASSERT(input.inputs.size() == 1);
-		const string indicator = StringValue::Get(input.inputs[0]);
-
-		if (indicator.empty()) {
+	static void CheckArguments(const vector<string> &args) {
+		if (args[0].empty()) {
 			throw InvalidInputException("SUDAN: The indicator parameter cannot be empty for SUDAN_WHO().");
 		}
-
-		std::vector<string> countries;
-		auto options_param = input.named_parameters.find("countries");
-		if (options_param != input.named_parameters.end()) {
-			auto &items = options_param->second;
-			if (!items.IsNull() && items.type() == LogicalType::LIST(LogicalType::VARCHAR)) {
-				for (const auto &item : ListValue::GetChildren(items)) {
-					countries.push_back(sudan::NormalizeCountryCode(item.GetValue<string>()));
-				}
-			}
-		}
-		if (countries.empty()) {
-			countries.push_back("SDN");
-		}
-
-		names.emplace_back("indicator_code");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("indicator_name");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("country");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("year");
-		return_types.push_back(LogicalType::INTEGER);
-		names.emplace_back("sex");
-		return_types.push_back(LogicalType::VARCHAR);
-		names.emplace_back("value");
-		return_types.push_back(LogicalType::DOUBLE);
-		names.emplace_back("region");
-		return_types.push_back(LogicalType::VARCHAR);
-
-		return make_uniq_base<FunctionData, BindData>(indicator, countries);
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
-	// Init
+	// Fetch
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct State final : GlobalTableFunctionState {
-		std::vector<DataRow> rows;
-		idx_t current_row;
-
-		explicit State() : current_row(0) {
-		}
-	};
-
-	static void FetchWHOData(const HttpSettings &settings, const string &indicator, const string &country_iso3,
-	                         std::vector<DataRow> &rows) {
+	static void Fetch(const HttpSettings &settings, const ProviderScanBindData &bind_data,
+	                  const vector<string> &countries, ProviderRowWriter &writer) {
+		auto &indicator = bind_data.args[0];
 
 		// WHO GHO OData API: https://ghoapi.azureedge.net/api/{indicator}?$filter=SpatialDim eq '{country}'
-		string url = "https://ghoapi.azureedge.net/api/" + indicator +
-		             "?$filter=SpatialDim eq '" + country_iso3 + "'";
-
-		auto &cache = sudan::ResponseCache::Instance();
-		string body = cache.Get(url);
-
-		if (body.empty()) {
-			auto response = HttpClient::Get(settings, url);
-			if (response.status_code != 200 || !response.error.empty()) {
-				return;
-			}
-			body = response.body;
-			cache.Put(url, body);
+		// The GHO endpoint does not support the OData 4.01 'in' operator, so a batch is a chain of 'or' terms
+		vector<string> country_terms;
+		for (auto &country_iso3 : countries) {
+			country_terms.push_back("SpatialDim eq '" + country_iso3 + "'");
 		}
-
-		auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
-		if (!json_data) {
-			return;
+		string country_clause = StringUtil::Join(country_terms, " or ");
+		if (countries.size() > 1) {
+			country_clause = "(" + country_clause + ")";
 		}
-
-		auto root_val = yyjson_doc_get_root(json_data);
-		auto value_arr = yyjson_obj_get(root_val, "value");
-		if (!yyjson_is_arr(value_arr)) {
-			yyjson_doc_free(json_data);
-			return;
+		string url = "https://ghoapi.azureedge.net/api/" + indicator + "?$filter=" + country_clause;
+		string year_clause = sudan::EncodeWHOYearClause(bind_data.year_filter);
+		if (!year_clause.empty()) {
+			url += " and " + year_clause;
+		}
+		// A pushed-down LIMIT (or ORDER BY year LIMIT) becomes an OData $top, sorted by year when the order matters
+		if (bind_data.row_limit > 0) {
+			if (bind_data.year_order != ScanYearOrder::ANY) {
+				url += bind_data.year_order == ScanYearOrder::DESCENDING ? "&$orderby=TimeDim desc"
+				                                                         : "&$orderby=TimeDim asc";
+			}
+			url += "&$top=" + std::to_string(bind_data.row_limit);
 		}
 
-		auto arr_len = yyjson_arr_size(value_arr);
-
-		for (size_t i = 0; i < arr_len; i++) {
-			auto elem = yyjson_arr_get(value_arr, i);
-
-			DataRow row;
-			row.indicator_code = indicator;
-			row.country = country_iso3;
-			row.has_value = false;
-			row.year = 0;
+		// Rows are written as the OData "value" elements arrive, overlapping the parse with the download
+		FetchStreamed(settings, url, "value", [&](yyjson_val *elem) {
+			writer.NewRow();
 
-			// IndicatorCode
+			// IndicatorCode (WHO GHO doesn't include the indicator name in data responses)
 			auto code_val = yyjson_obj_get(elem, "IndicatorCode");
-			if (yyjson_is_str(code_val)) {
-				row.indicator_code = yyjson_get_str(code_val);
-			}
+			writer.SetString(0, yyjson_is_str(code_val) ? yyjson_get_str(code_val) : indicator.c_str());
+
+			// SpatialDim
+			auto spatial_val = yyjson_obj_get(elem, "SpatialDim");
+			writer.SetString(2, yyjson_is_str(spatial_val) ? yyjson_get_str(spatial_val) : "");
 
 			// TimeDim (year)
 			auto time_val = yyjson_obj_get(elem, "TimeDim");
 			if (yyjson_is_int(time_val)) {
-				row.year = yyjson_get_int(time_val);
+				writer.SetInteger(3, yyjson_get_int(time_val));
 			} else if (yyjson_is_str(time_val)) {
-				try {
-					row.year = std::stoi(yyjson_get_str(time_val));
-				} catch (...) {
-					row.year = 0;
-				}
-			}
-
-			// SpatialDim
-			auto spatial_val = yyjson_obj_get(elem, "SpatialDim");
-			if (yyjson_is_str(spatial_val)) {
-				row.country = yyjson_get_str(spatial_val);
+				writer.SetInteger(3, ParseYear(yyjson_get_str(time_val)));
+			} else {
+				writer.SetInteger(3, 0);
 			}
 
 			// Dim1 (sex)
 			auto dim1_val = yyjson_obj_get(elem, "Dim1");
-			if (yyjson_is_str(dim1_val)) {
-				row.sex = yyjson_get_str(dim1_val);
+			if (yyjson_is_str(dim1_val) && yyjson_get_len(dim1_val) > 0) {
+				writer.SetString(4, yyjson_get_str(dim1_val));
 			}
 
 			// NumericValue
 			auto num_val = yyjson_obj_get(elem, "NumericValue");
-			if (yyjson_is_real(num_val)) {
-				row.value = yyjson_get_real(num_val);
-				row.has_value = true;
-			} else if (yyjson_is_int(num_val)) {
-				row.value = static_cast<double>(yyjson_get_int(num_val));
-				row.has_value = true;
+			if (yyjson_is_num(num_val)) {
+				writer.SetDouble(5, yyjson_get_num(num_val));
 			}
 
 			// ParentLocation (region)
 			auto parent_val = yyjson_obj_get(elem, "ParentLocation");
-			if (yyjson_is_str(parent_val)) {
-				row.region = yyjson_get_str(parent_val);
-			}
-
-			// Get indicator name from first element
-			if (rows.empty()) {
-				// We'll set indicator_name from the API if available
-				// WHO GHO doesn't include indicator name in data responses
-			}
-
-			rows.push_back(row);
-		}
-
-		yyjson_doc_free(json_data);
-	}
-
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
-		auto &state = global_state->Cast<State>();
-
-		HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://ghoapi.azureedge.net");
-		settings.timeout = 90;
-
-		for (const auto &country : bind_data.countries) {
-			FetchWHOData(settings, bind_data.indicator, country, state.rows);
-		}
-
-		return global_state;
-	}
-
-	//------------------------------------------------------------------------------------------------------------------
-	// Execute
-	//------------------------------------------------------------------------------------------------------------------
-
-	static void Execute(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
-		auto &state = input.global_state->Cast<State>();
-
-		const auto output_size = std::min<idx_t>(STANDARD_VECTOR_SIZE, state.rows.size() - state.current_row);
-
-		if (output_size == 0) {
-			output.SetCardinality(0);
-			return;
-		}
-
-		for (idx_t row_idx = 0; row_idx < output_size; row_idx++) {
-			const auto &row = state.rows[state.current_row + row_idx];
-			output.data[0].SetValue(row_idx, row.indicator_code);
-			output.data[1].SetValue(row_idx, row.indicator_name.empty() ? Value() : Value(row.indicator_name));
-			output.data[2].SetValue(row_idx, row.country);
-			output.data[3].SetValue(row_idx, Value::INTEGER(row.year));
-			output.data[4].SetValue(row_idx, row.sex.empty() ? Value() : Value(row.sex));
-			if (row.has_value) {
-				output.data[5].SetValue(row_idx, Value::DOUBLE(row.value));
-			} else {
-				output.data[5].SetValue(row_idx, Value());
+			if (yyjson_is_str(parent_val) && yyjson_get_len(parent_val) > 0) {
+				writer.SetString(6, yyjson_get_str(parent_val));
 			}
-			output.data[6].SetValue(row_idx, row.region.empty() ? Value() : Value(row.region));
-		}
-
-		state.current_row += output_size;
-		output.SetCardinality(output_size);
+		});
 	}
 
 	//------------------------------------------------------------------------------------------------------------------
@@ -267,24 +136,10 @@ struct SudanWHO {
 		-- Compare Sudan and South Sudan
 		SELECT * FROM SUDAN_WHO('WHOSIS_000001', countries := ['SDN', 'SSD']);
 	)";
-
-	//------------------------------------------------------------------------------------------------------------------
-	// Register
-	//------------------------------------------------------------------------------------------------------------------
-
-	static void Register(ExtensionLoader &loader) {
-
-		InsertionOrderPreservingMap<string> tags;
-		tags.insert("ext", "sudan");
-		tags.insert("category", "table");
-
-		TableFunction func("SUDAN_WHO", {LogicalType::VARCHAR}, Execute, Bind, Init);
-		func.named_parameters["countries"] = LogicalType::LIST(LogicalType::VARCHAR);
-
-		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
-	}
 };
 
+constexpr ProviderColumn WHOScan::COLUMNS[];
+
 //======================================================================================================================
 // SUDAN_WHO_Indicators
 //======================================================================================================================
@@ -332,11 +187,8 @@ struct SudanWHOIndicators {
 		}
 	};
 
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
-		auto &state = global_state->Cast<State>();
-
+	//! Fetch the GHO indicator catalog, keeping entries that match the search term
+	static void FetchIndicators(ClientContext &context, const string &search, std::vector<IndicatorInfo> &rows) {
 		string url = "https://ghoapi.azureedge.net/api/Indicator";
 
 		auto &cache = sudan::ResponseCache::Instance();
@@ -345,25 +197,25 @@ struct SudanWHOIndicators {
 		if (body.empty()) {
 			auto response = HttpClient::Get(context, url);
 			if (response.status_code != 200 || !response.error.empty()) {
-				return global_state;
+				return;
 			}
-			body = response.body;
+			body = std::move(response.body);
 			cache.Put(url, body);
 		}
 
 		auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
 		if (!json_data) {
-			return global_state;
+			return;
 		}
 
 		auto root_val = yyjson_doc_get_root(json_data);
 		auto value_arr = yyjson_obj_get(root_val, "value");
 		if (!yyjson_is_arr(value_arr)) {
 			yyjson_doc_free(json_data);
-			return global_state;
+			return;
 		}
 
-		string search_lower = StringUtil::Lower(bind_data.search);
+		string search_lower = StringUtil::Lower(search);
 		auto arr_len = yyjson_arr_size(value_arr);
 
 		for (size_t i = 0; i < arr_len; i++) {
@@ -393,10 +245,19 @@ struct SudanWHOIndicators {
 				}
 			}
 
-			state.rows.push_back(info);
+			rows.push_back(info);
 		}
 
 		yyjson_doc_free(json_data);
+	}
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
+		auto &state = global_state->Cast<State>();
+
+		FetchIndicators(context, bind_data.search, state.rows);
+
 		return global_state;
 	}
 
@@ -449,8 +310,28 @@ struct SudanWHOIndicators {
 //======================================================================================================================
 
 void WHOFunctions::Register(ExtensionLoader &loader) {
-	SudanWHO::Register(loader);
+	ProviderScan<WHOScan>::Register(loader);
 	SudanWHOIndicators::Register(loader);
 }
 
+TableFunction WHOFunctions::GetCatalogScan(const string &indicator, const vector<string> &countries,
+                                           vector<LogicalType> &return_types, vector<string> &names,
+                                           unique_ptr<FunctionData> &bind_data) {
+	return ProviderScan<WHOScan>::GetCatalogScan({indicator}, countries, return_types, names, bind_data);
+}
+
+vector<string> WHOFunctions::ListIndicatorCodes(ClientContext &context) {
+	std::vector<SudanWHOIndicators::IndicatorInfo> rows;
+	SudanWHOIndicators::FetchIndicators(context, "", rows);
+
+	vector<string> codes;
+	codes.reserve(rows.size());
+	for (auto &info : rows) {
+		if (!info.code.empty()) {
+			codes.push_back(std::move(info.code));
+		}
+	}
+	return codes;
+}
+
 } // namespace duckdb
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "duckdb.hpp"
+#include "duckdb/function/table_function.hpp"
+
 namespace duckdb {
 
 class ExtensionLoader;
@@ -7,6 +10,14 @@ class ExtensionLoader;
 struct WHOFunctions {
 public:
 	static void Register(ExtensionLoader &loader);
+
+	//! Create a SUDAN_WHO scan over a single indicator (used by the ATTACH catalog)
+	static TableFunction GetCatalogScan(const string &indicator, const vector<string> &countries,
+	                                    vector<LogicalType> &return_types, vector<string> &names,
+	                                    unique_ptr<FunctionData> &bind_data);
+
+	//! List all GHO indicator codes (served from the response cache when warm)
+	static vector<string> ListIndicatorCodes(ClientContext &context);
 };
 
 } // namespace duckdb
@@ -13,6 +13,8 @@ using namespace duckdb_yyjson; // NOLINT
 // SUDAN
 #include "sudan/http_client.hpp"
 #include "sudan/cache.hpp"
+#include "sudan/provider_scan.hpp"
+#include "sudan/scan_optimizer.hpp"
 
 namespace duckdb {
 
@@ -35,7 +37,7 @@ struct SudanWBIndicators {
 	// Bind
 	//------------------------------------------------------------------------------------------------------------------
 
-	struct BindData final : TableFunctionData {
+	struct BindData final : LimitedScanData {
 		string search;
 
 		explicit BindData(const string &search) : search(search) {
@@ -78,20 +80,23 @@ struct SudanWBIndicators {
 		}
 	};
 
-	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
-		auto &bind_data = input.bind_data->Cast<BindData>();
-		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
-		auto &state = global_state->Cast<State>();
-
-		// Fetch indicator list from World Bank
+	//! Fetch the pages of the World Bank indicator catalog, keeping entries that match the search term, until
+	//! row_limit entries are found (0 = all pages)
+	static void FetchIndicators(const HttpSettings &settings, const string &search, idx_t row_limit,
+	                            std::vector<IndicatorInfo> &rows) {
 		int page = 1;
 		int total_pages = 1;
-		HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://api.worldbank.org");
-		settings.timeout = 90;
+		string search_lower = StringUtil::Lower(search);
+
+		// Without a search every entry counts, so a small LIMIT only needs a small first page
+		idx_t per_page = 1000;
+		if (row_limit > 0 && search_lower.empty()) {
+			per_page = MinValue<idx_t>(per_page, row_limit);
+		}
 
-		while (page <= total_pages) {
-			string url = "https://api.worldbank.org/v2/indicator?format=json&per_page=1000&page=" +
-			             std::to_string(page);
+		while (page <= total_pages && (row_limit == 0 || rows.size() < row_limit)) {
+			string url = "https://api.worldbank.org/v2/indicator?format=json&per_page=" + std::to_string(per_page) +
+			             "&page=" + std::to_string(page);
 
 			auto &cache = sudan::ResponseCache::Instance();
 			string body = cache.Get(url);
@@ -101,7 +106,7 @@ struct SudanWBIndicators {
 				if (response.status_code != 200 || !response.error.empty()) {
 					break;
 				}
-				body = response.body;
+				body = std::move(response.body);
 				cache.Put(url, body);
 			}
 
@@ -127,7 +132,6 @@ struct SudanWBIndicators {
 
 			auto data_arr = yyjson_arr_get(root_val, 1);
 			if (yyjson_is_arr(data_arr)) {
-				string search_lower = StringUtil::Lower(bind_data.search);
 				auto arr_len = yyjson_arr_size(data_arr);
 
 				for (size_t i = 0; i < arr_len; i++) {
@@ -165,13 +169,23 @@ struct SudanWBIndicators {
 						}
 					}
 
-					state.rows.push_back(info);
+					rows.push_back(info);
 				}
 			}
 
 			yyjson_doc_free(json_data);
 			page++;
 		}
+	}
+
+	static unique_ptr<GlobalTableFunctionState> Init(ClientContext &context, TableFunctionInitInput &input) {
+		auto &bind_data = input.bind_data->Cast<BindData>();
+		auto global_state = make_uniq_base<GlobalTableFunctionState, State>();
+		auto &state = global_state->Cast<State>();
+
+		HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://api.worldbank.org");
+
+		FetchIndicators(settings, bind_data.search, bind_data.HasRowLimit() ? bind_data.row_limit : 0, state.rows);
 
 		return global_state;
 	}
@@ -241,6 +255,7 @@ struct SudanWBIndicators {
 
 		TableFunction func("SUDAN_WB_Indicators", {}, Execute, Bind, Init);
 		func.named_parameters["search"] = LogicalType::VARCHAR;
+		ScanOptimizer::EnableLimitPushdown(func);
 
 		RegisterFunction<TableFunction>(loader, func, CatalogType::TABLE_FUNCTION_ENTRY, DESCRIPTION, EXAMPLE, tags);
 	}
@@ -256,4 +271,39 @@ void WorldBankIndicatorFunctions::Register(ExtensionLoader &loader) {
 	SudanWBIndicators::Register(loader);
 }
 
+vector<string> WorldBankIndicatorFunctions::ListIndicatorIds(ClientContext &context) {
+	HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://api.worldbank.org");
+
+	std::vector<SudanWBIndicators::IndicatorInfo> rows;
+	SudanWBIndicators::FetchIndicators(settings, "", 0, rows);
+
+	vector<string> ids;
+	ids.reserve(rows.size());
+	for (auto &info : rows) {
+		if (!info.id.empty()) {
+			ids.push_back(std::move(info.id));
+		}
+	}
+	return ids;
+}
+
+bool WorldBankIndicatorFunctions::IndicatorExists(ClientContext &context, const string &id) {
+	HttpSettings settings = HttpClient::ExtractHttpSettings(context, "https://api.worldbank.org");
+	string body;
+	if (!FetchCached(settings, "https://api.worldbank.org/v2/indicator/" + StringUtil::URLEncode(id) + "?format=json",
+	                 body)) {
+		return false;
+	}
+	auto json_data = yyjson_read(body.c_str(), body.size(), YYJSON_READ_NOFLAG);
+	if (!json_data) {
+		return false;
+	}
+	// Known ids return [metadata, [indicator]], unknown ones a single [{"message": [...]}]
+	auto root_val = yyjson_doc_get_root(json_data);
+	auto exists = yyjson_is_arr(root_val) && yyjson_arr_size(root_val) >= 2 &&
+	              yyjson_arr_size(yyjson_arr_get(root_val, 1)) > 0;
+	yyjson_doc_free(json_data);
+	return exists;
+}
+
 } // namespace duckdb
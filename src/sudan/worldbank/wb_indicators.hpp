@@ -1,5 +1,7 @@
 #pragma once
 
+#include "duckdb.hpp"
+
 namespace duckdb {
 
 class ExtensionLoader;
@@ -7,6 +9,12 @@ class ExtensionLoader;
 struct WorldBankIndicatorFunctions {
 public:
 	static void Register(ExtensionLoader &loader);
+
+	//! List all World Bank indicator ids (served from the response cache when warm)
+	static vector<string> ListIndicatorIds(ClientContext &context);
+
+	//! Whether an indicator id exists, with a single-indicator request instead of the full catalog
+	static bool IndicatorExists(ClientContext &context, const string &id);
 };
 
 } // namespace duckdb
@@ -15,10 +15,21 @@
 #include "sudan/ilo/ilo_functions.hpp"
 #include "sudan/geo/geo_functions.hpp"
 #include "sudan/info/info_functions.hpp"
+#include "sudan/catalog/sudan_storage.hpp"
+#include "sudan/custom/custom_provider.hpp"
+#include "sudan/analytics/analytics_functions.hpp"
+#include "sudan/query_budget.hpp"
+#include "sudan/scan_optimizer.hpp"
 
 namespace duckdb {
 
 static void LoadInternal(ExtensionLoader &loader) {
+	// Register settings
+	QueryBudget::Register(loader);
+
+	// Register the LIMIT pushdown into provider scans
+	ScanOptimizer::Register(loader);
+
 	// Register functions
 	WorldBankFunctions::Register(loader);
 	WorldBankIndicatorFunctions::Register(loader);
@@ -28,6 +39,11 @@ static void LoadInternal(ExtensionLoader &loader) {
 	ILOFunctions::Register(loader);
 	GeoFunctions::Register(loader);
 	InfoFunctions::Register(loader);
+	CustomProviderFunctions::Register(loader);
+	AnalyticsFunctions::Register(loader);
+
+	// Register ATTACH ... (TYPE sudan)
+	SudanStorageFunctions::Register(loader);
 }
 
 void SudanExtension::Load(ExtensionLoader &loader) {